@@ -405,7 +405,6 @@ ctr_object* ctr_object_case_do( ctr_object* myself, ctr_argument* argumentList )
 		myself->info.sticky = sticky;
 		if (CtrStdFlow == CtrStdContinue) CtrStdFlow = NULL; /* consume continue */
 		if (CtrStdFlow == CtrStdBreak) CtrStdFlow = NULL; /* consume break */
-		block->info.mark = 0;
 		block->info.sticky = 0;
 	}
 	ctr_heap_free( compareArguments );
@@ -571,11 +570,12 @@ ctr_object* ctr_object_learn_meaning(ctr_object* myself, ctr_argument* ctr_argum
        char*  current_method_name_str;
        ctr_size     current_method_name_len;
        ctr_size     i                      = 0;
-       ctr_mapitem* current_method         = myself->methods->head;
+       ctr_mapitem* current_method         = myself->methods ? myself->methods->head : NULL;
        ctr_object*  target_method_name     = ctr_internal_cast2string( ctr_argumentList->next->object );
        char*        target_method_name_str = target_method_name->value.svalue->value;
        ctr_size     target_method_name_len = target_method_name->value.svalue->vlen;
        ctr_object*  alias                  = ctr_internal_cast2string( ctr_argumentList->object );
+       if ( current_method == NULL ) return myself;
        while( i < myself->methods->size ) {
                current_method_name_str = current_method->key->value.svalue->value;
                current_method_name_len = current_method->key->value.svalue->vlen;
@@ -911,6 +911,32 @@ ctr_object* ctr_build_number_from_float(ctr_number f) {
 	return numberObject;
 }
 
+/**
+ * @internal
+ * BuildSmallNumber
+ *
+ * Returns the result of an arithmetic operation. Small integers
+ * are shared constants that are never allocated nor swept, like
+ * literals they are copied when stored or changed (copy-on-write).
+ * Other numbers are built as usual.
+ */
+ctr_object ctr_small_numbers[CTR_SMALL_NUMBER_MAX - CTR_SMALL_NUMBER_MIN + 1];
+ctr_object* ctr_build_small_number(ctr_number f) {
+	ctr_object* numberObject;
+	if (f < CTR_SMALL_NUMBER_MIN || f > CTR_SMALL_NUMBER_MAX || f != (int) f || (f == 0 && signbit(f))) {
+		return ctr_build_number_from_float(f);
+	}
+	numberObject = &ctr_small_numbers[(int) f - CTR_SMALL_NUMBER_MIN];
+	if (!numberObject->link) {
+		numberObject->info.type = CTR_OBJECT_TYPE_OTNUMBER;
+		numberObject->info.constant = 1;
+		numberObject->info.old = 1;
+		numberObject->value.nvalue = f;
+		numberObject->link = CtrStdNumber;
+	}
+	return numberObject;
+}
+
 /**
  * @def
  * [ Number ] > [ Number ]
@@ -1090,7 +1116,7 @@ ctr_object* ctr_number_add(ctr_object* myself, ctr_argument* argumentList) {
 	}
 	a = myself->value.nvalue;
 	b = otherNum->value.nvalue;
-	return ctr_build_number_from_float((a+b));
+	return ctr_build_small_number((a+b));
 }
 
 /**
@@ -1121,7 +1147,7 @@ ctr_object* ctr_number_minus(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* otherNum = ctr_internal_cast2number(argumentList->object);
 	ctr_number a = myself->value.nvalue;
 	ctr_number b = otherNum->value.nvalue;
-	return ctr_build_number_from_float((a-b));
+	return ctr_build_small_number((a-b));
 }
 
 /**
@@ -1154,7 +1180,7 @@ ctr_object* ctr_number_multiply(ctr_object* myself, ctr_argument* argumentList)
 	otherNum = ctr_internal_cast2number(argumentList->object);
 	a = myself->value.nvalue;
 	b = otherNum->value.nvalue;
-	return ctr_build_number_from_float(a*b);
+	return ctr_build_small_number(a*b);
 }
 
 /**
@@ -1182,7 +1208,6 @@ ctr_object* ctr_block_times(ctr_object* myself, ctr_argument* argumentList) {
 	}
 	ctr_heap_free( arguments );
 	if (CtrStdFlow == CtrStdBreak) CtrStdFlow = NULL; /* consume break */
-	block->info.mark = 0;
 	block->info.sticky = 0;
 	return myself;
 }
@@ -1213,7 +1238,6 @@ ctr_object* ctr_block_procedure(ctr_object* myself, ctr_argument* argumentList)
 	ctr_heap_free( arguments );
 	if (CtrStdFlow == CtrStdBreak) CtrStdFlow = NULL; /* consume break */
 	if (CtrStdFlow == CtrStdContinue) CtrStdFlow = NULL; /* should not be used, but is accepted anyway */
-	block->info.mark = 0;
 	block->info.sticky = 0;
 	return myself;
 }
@@ -1248,7 +1272,7 @@ ctr_object* ctr_number_divide(ctr_object* myself, ctr_argument* argumentList) {
 		CtrStdFlow = ctr_error( CTR_ERR_DIVZERO, 0 );
 		return myself;
 	}
-	return ctr_build_number_from_float((a/b));
+	return ctr_build_small_number((a/b));
 }
 
 /**
@@ -1286,7 +1310,7 @@ ctr_object* ctr_number_modulo(ctr_object* myself, ctr_argument* argumentList) {
 		CtrStdFlow = ctr_error( CTR_ERR_DIVZERO, 0 );
 		return myself;
 	}
-	return ctr_build_number_from_float(fmod(a,b));
+	return ctr_build_small_number(fmod(a,b));
 }
 
 /**
@@ -1513,6 +1537,48 @@ ctr_object* ctr_number_bit_xor(ctr_object* myself, ctr_argument* argumentList) {
 	return ctr_build_number_from_float((int)myself->value.nvalue ^ (int)ctr_tonum(argumentList->object));
 }
 
+/**
+ * @internal
+ * Writes a number the way [ Number ] string does (without a qualifier)
+ * into the buffer, which must hold CTR_NUMBER_FORMAT_SIZE bytes, and
+ * returns the length. Whole numbers skip snprintf. Returns 0 for numbers
+ * that are too large or not finite, use the message for those.
+ */
+ctr_size ctr_internal_number_format(ctr_number n, char* buffer) {
+	char digits[CTR_NUMBER_FORMAT_SIZE];
+	uint64_t whole;
+	ctr_size count = 0;
+	ctr_size length = 0;
+	ctr_size i;
+	char* p;
+	if (!(fabs(n) < 1e15)) return 0;
+	if (n == (ctr_number)(int64_t) n && !(n == 0 && signbit(n))) {
+		if (n < 0) buffer[length++] = '-';
+		whole = (uint64_t) fabs(n);
+		do {
+			digits[count++] = '0' + (whole % 10);
+			whole /= 10;
+		} while(whole);
+		for(i = count; i > 0; i--) {
+			if (i < count && (i % 3) == 0) {
+				memcpy(buffer + length, CTR_DICT_NUM_THO_SEP, ctr_clex_keyword_num_sep_tho_len);
+				length += ctr_clex_keyword_num_sep_tho_len;
+			}
+			buffer[length++] = digits[i - 1];
+		}
+		buffer[length] = '\0';
+		return length;
+	}
+	snprintf( digits, 99, "%.10f", n );
+	p = digits + strlen(digits) - 1;
+	while ( *p == '0' && *p-- != '.' );
+	*( p + 1 ) = '\0';
+	if ( *p == '.' ) *p = '\0';
+	memset( buffer, 0, CTR_NUMBER_FORMAT_SIZE );
+	ctr_international_number( digits, buffer );
+	return strlen( buffer );
+}
+
 /**
  * @internal
  * Generic method, used by:
@@ -1620,6 +1686,7 @@ ctr_object* ctr_build_string(char* stringValue, ctr_size size) {
 		memcpy(stringObject->value.svalue->value, stringValue, ( sizeof(char) * size ) );
 	}
 	stringObject->value.svalue->vlen = size;
+	stringObject->value.svalue->capacity = size;
 	stringObject->link = CtrStdString;
 	return stringObject;
 }
@@ -1661,6 +1728,7 @@ ctr_object* ctr_build_empty_string() {
  */
 ctr_object* ctr_string_eval(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_tnode* parsedCode;
+	ctr_bytecode* code = NULL;
 	ctr_object* result;
 	char* prg;
 	int ctr_callstack_index_old = ctr_callstack_index;
@@ -1674,16 +1742,27 @@ ctr_object* ctr_string_eval(ctr_object* myself, ctr_argument* argumentList) {
 		ctr_heap_free( prg );
 		return CtrStdNil;
 	}
-	ctr_heap_free( prg );
 	ctr_cwlk_subprogram++;
 	char r;
 	ctr_deserialize_mode = 1;
-	result = ctr_cwlk_expr(parsedCode,&r);
+	if (ctr_vm_mode) {
+		code = ctr_vm_compile_expression(parsedCode);
+	}
+	if (code) {
+		result = ctr_vm_run(code);
+	} else {
+		result = ctr_cwlk_expr(parsedCode,&r);
+	}
 	ctr_deserialize_mode = 0;
 	ctr_source_mapping = 1;
 	ctr_callstack_index = ctr_callstack_index_old;
 	ctr_cwlk_subprogram--;
+	/* literal constants are freed along with the parsed code */
+	if (result) result = ctr_internal_constant_clone(result);
+	if (CtrStdFlow) CtrStdFlow = ctr_internal_constant_clone(CtrStdFlow);
 	ctr_heap_tracker_rewind(memblock);
+	/* the parsed code refers to the program text, free it afterwards */
+	ctr_heap_free( prg );
 	if (result == NULL) {
 		return CtrStdNil;
 	}
@@ -1737,7 +1816,7 @@ ctr_object* ctr_string_neq(ctr_object* myself, ctr_argument* argumentList) {
  * ✎ write: x length, stop.
  */
 ctr_object* ctr_string_length(ctr_object* myself, ctr_argument* argumentList) {
-	ctr_size n = ctr_getutf8len(myself->value.svalue->value, (ctr_size) myself->value.svalue->vlen);
+	ctr_size n = ctr_utf8_length(myself->value.svalue);
 	return ctr_build_number_from_float((ctr_number) n);
 }
 
@@ -1791,25 +1870,53 @@ ctr_object* ctr_string_concat(ctr_object* myself, ctr_argument* argumentList) {
  */
 ctr_object* ctr_string_append(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* strObject;
-	ctr_size n1;
-	ctr_size n2;
-	char* dest;
 	ctr_gc_internal_pin(myself);
 	strObject = ctr_internal_cast2string(argumentList->object);
-	n1 = myself->value.svalue->vlen;
-	n2 = strObject->value.svalue->vlen;
-	if ( ( n1 + n2 ) == 0 ) return myself;
-	dest = ctr_heap_allocate( sizeof( char ) * ( n1 + n2 ) );
-	memcpy(dest, myself->value.svalue->value, n1);
-	memcpy(dest+n1, strObject->value.svalue->value, n2);
-	if ( n1 > 0 ) {
-		ctr_heap_free( myself->value.svalue->value );
-	}
-	myself->value.svalue->value = dest;
-	myself->value.svalue->vlen  = (n1 + n2);
+	ctr_internal_string_append(myself->value.svalue, strObject->value.svalue->value, strObject->value.svalue->vlen);
 	return myself;
 }
 
+/**
+ * @internal
+ * StringReserve
+ *
+ * Makes room for the specified number of bytes in the buffer of a string.
+ * The buffer grows geometrically so a series of appends takes amortized
+ * constant time per append. A capacity of 0 means the buffer holds
+ * exactly vlen bytes, or refers to a static empty C-string if vlen is 0.
+ */
+void ctr_internal_string_reserve(ctr_string* s, ctr_size size) {
+	ctr_size capacity;
+	if (size <= s->capacity) return;
+	capacity = s->capacity + (s->capacity >> 1);
+	if (capacity < size) capacity = size;
+	if (capacity < CTR_STRING_MIN_CAPACITY) capacity = CTR_STRING_MIN_CAPACITY;
+	if (s->vlen > 0 || s->capacity > 0) {
+		s->value = ctr_heap_reallocate(s->value, capacity * sizeof(char));
+	} else {
+		s->value = ctr_heap_allocate(capacity * sizeof(char));
+	}
+	s->capacity = capacity;
+}
+
+/**
+ * @internal
+ * StringAppend
+ *
+ * Appends bytes to the buffer of a string, the bytes may
+ * belong to the string itself.
+ */
+void ctr_internal_string_append(ctr_string* s, char* value, ctr_size vlen) {
+	ctr_size offset = 0;
+	int self = (s->vlen > 0 && value >= s->value && value < s->value + s->vlen);
+	if (vlen == 0) return;
+	if (self) offset = value - s->value;
+	ctr_internal_string_reserve(s, s->vlen + vlen);
+	if (self) value = s->value + offset;
+	memcpy(s->value + s->vlen, value, vlen);
+	s->vlen += vlen;
+	ctr_utf8_forget(s);
+}
 
 ctr_object* ctr_string_new(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* stringObject = ctr_build_empty_string();
@@ -1817,6 +1924,93 @@ ctr_object* ctr_string_new(ctr_object* myself, ctr_argument* argumentList) {
 	return stringObject;
 }
 
+/**
+ * @def
+ * Buffer
+ *
+ * A buffer collects text to build a large string piece by piece.
+ * The string message returns a copy of the contents, flush hands
+ * them over to a new string without copying them.
+ *
+ * @example
+ * ☞ x ≔ Buffer new.
+ * x append: ‘<p>’, append: 123, append: ‘</p>’.
+ * ✎ write: x flush, stop.
+ */
+ctr_object* ctr_buffer_new(ctr_object* myself, ctr_argument* argumentList) {
+	ctr_object* buffer = ctr_internal_create_object(CTR_OBJECT_TYPE_OTSTRING);
+	buffer->link = myself;
+	return buffer;
+}
+
+/**
+ * @def
+ * [ Buffer ] type
+ *
+ * @example
+ * ✎ write: Buffer new type, stop.
+ */
+ctr_object* ctr_buffer_type(ctr_object* myself, ctr_argument* argumentList) {
+	return ctr_build_string_from_cstring( CTR_DICT_BUFFER );
+}
+
+/**
+ * @def
+ * [ Buffer ] append: [ String ]
+ *
+ * @example
+ * ☞ x ≔ Buffer new.
+ * { :i x append: i. } × 5.
+ * ✎ write: x string, stop.
+ */
+ctr_object* ctr_buffer_append(ctr_object* myself, ctr_argument* argumentList) {
+	ctr_object* strObject;
+	int sticky = myself->info.sticky;
+	myself->info.sticky = 1;
+	strObject = ctr_internal_cast2string(argumentList->object);
+	myself->info.sticky = sticky;
+	ctr_internal_string_append(myself->value.svalue, strObject->value.svalue->value, strObject->value.svalue->vlen);
+	return myself;
+}
+
+/**
+ * @def
+ * [ Buffer ] string
+ *
+ * Returns a copy of the contents of the buffer as a string.
+ *
+ * @example
+ * ☞ x ≔ Buffer new.
+ * x append: ‘abc’.
+ * ✎ write: x string, stop.
+ * ✎ write: x length, stop.
+ */
+ctr_object* ctr_buffer_to_string(ctr_object* myself, ctr_argument* argumentList) {
+	return ctr_build_string(myself->value.svalue->value, myself->value.svalue->vlen);
+}
+
+/**
+ * @def
+ * [ Buffer ] flush
+ *
+ * Returns the contents of the buffer as a string without copying
+ * them and empties the buffer.
+ *
+ * @example
+ * ☞ x ≔ Buffer new.
+ * x append: ‘abc’.
+ * ✎ write: x flush, stop.
+ * ✎ write: x length, stop.
+ */
+ctr_object* ctr_buffer_flush(ctr_object* myself, ctr_argument* argumentList) {
+	ctr_object* stringObject = ctr_internal_create_object(CTR_OBJECT_TYPE_OTSTRING);
+	ctr_string* contents = myself->value.svalue;
+	myself->value.svalue = stringObject->value.svalue;
+	stringObject->value.svalue = contents;
+	stringObject->link = CtrStdString;
+	return stringObject;
+}
+
 /**
  * @def
  * [ String ] code
@@ -1871,17 +2065,19 @@ ctr_object* ctr_string_to_code(ctr_object* myself, ctr_argument* argumentList) {
 ctr_object* ctr_string_from_length(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* fromPos = ctr_internal_cast2number(argumentList->object);
 	ctr_object* length = ctr_internal_cast2number(argumentList->next->object);
-	long len = myself->value.svalue->vlen;
+	long len = ctr_utf8_length(myself->value.svalue);
 	long a = (fromPos->value.nvalue) - 1;
 	long b = (length->value.nvalue);
 	long ua, ub;
 	char* dest;
 	if (b == 0 || len == 0) {
-		if (len) {
+		if (len || myself->value.svalue->capacity) {
 			ctr_heap_free( myself->value.svalue->value );
 		}
 		myself->value.svalue->value = "";
 		myself->value.svalue->vlen = 0;
+		myself->value.svalue->capacity = 0;
+		ctr_utf8_forget(myself->value.svalue);
 		return myself;
 	}
 	if (b < 0) {
@@ -1892,14 +2088,16 @@ ctr_object* ctr_string_from_length(ctr_object* myself, ctr_argument* argumentLis
 	if (a > len) a = len;
 	if ((a + b)>len) b = len - a;
 	if ((a + b)<0) b = b - a;
-	ua = getBytesUtf8(myself->value.svalue->value, 0, a);
-	ub = getBytesUtf8(myself->value.svalue->value, ua, b);
+	ua = ctr_utf8_offset(myself, a);
+	ub = ctr_utf8_offset(myself, a + b) - ua;
 	if (ub == 0) {
-		if (len) {
+		if (len || myself->value.svalue->capacity) {
 			ctr_heap_free( myself->value.svalue->value );
 		}
 		myself->value.svalue->value = "";
 		myself->value.svalue->vlen = 0;
+		myself->value.svalue->capacity = 0;
+		ctr_utf8_forget(myself->value.svalue);
 		return myself;
 	}
 	dest = ctr_heap_allocate( ub * sizeof(char) );
@@ -1907,6 +2105,8 @@ ctr_object* ctr_string_from_length(ctr_object* myself, ctr_argument* argumentLis
 	ctr_heap_free( myself->value.svalue->value );
 	myself->value.svalue->value = dest;
 	myself->value.svalue->vlen  = ub;
+	myself->value.svalue->capacity = ub;
+	ctr_utf8_forget(myself->value.svalue);
     return myself;
 }
 
@@ -1929,7 +2129,7 @@ ctr_object* ctr_string_skip(ctr_object* myself, ctr_argument* argumentList) {
 	argument2 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
 	argument1->object = ctr_build_number_from_float( a );
 	argument1->next = argument2;
-	textLength = ctr_getutf8len(myself->value.svalue->value, (ctr_size) myself->value.svalue->vlen);
+	textLength = ctr_utf8_length(myself->value.svalue);
 	argument2->object = ctr_build_number_from_float(textLength - (a - 1) );
 	result = ctr_string_from_length(myself, argument1);
 	ctr_heap_free( argument1 );
@@ -1947,11 +2147,11 @@ ctr_object* ctr_string_skip(ctr_object* myself, ctr_argument* argumentList) {
 ctr_object* ctr_string_at(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* fromPos = ctr_internal_cast2number(argumentList->object);
 	ctr_size a = (ctr_size) (fromPos->value.nvalue) - 1;
-	ctr_size textLength = ctr_getutf8len(myself->value.svalue->value, (ctr_size) myself->value.svalue->vlen);
+	ctr_size textLength = ctr_utf8_length(myself->value.svalue);
 	if (a < 0) return CtrStdNil;
 	if (a >= textLength) return CtrStdNil;
-	long ua = getBytesUtf8(myself->value.svalue->value, 0, a);
-	long ub = getBytesUtf8(myself->value.svalue->value, ua, 1);
+	long ua = ctr_utf8_offset(myself, a);
+	long ub = ctr_utf8_offset(myself, a + 1) - ua;
 	ctr_object* newString;
 	char* dest = ctr_heap_allocate( ub * sizeof( char ) );
 	memcpy(dest, (myself->value.svalue->value) + ua, ub);
@@ -1977,7 +2177,7 @@ ctr_object* ctr_string_index_of(ctr_object* myself, ctr_argument* argumentList)
 	char* p = ctr_internal_memmem(myself->value.svalue->value, hlen, sub->value.svalue->value, nlen, 0);
 	if (p == NULL) return ctr_build_nil();
 	byte_index = (uintptr_t) p - (uintptr_t) (myself->value.svalue->value);
-	uchar_index = ctr_getutf8len(myself->value.svalue->value, byte_index);
+	uchar_index = ctr_utf8_position(myself->value.svalue, byte_index);
 	return ctr_build_number_from_float((ctr_number) uchar_index + 1);
 }
 
@@ -1999,6 +2199,8 @@ ctr_object* ctr_string_to_upper(ctr_object* myself, ctr_argument* argumentList)
 	ctr_heap_free( myself->value.svalue->value );
 	myself->value.svalue->value = tstr;
 	myself->value.svalue->vlen  = len;
+	myself->value.svalue->capacity = len;
+	ctr_utf8_forget(myself->value.svalue);
 	return myself;
 }
 
@@ -2022,6 +2224,8 @@ ctr_object* ctr_string_to_lower(ctr_object* myself, ctr_argument* argumentList)
 	ctr_heap_free( myself->value.svalue->value );
 	myself->value.svalue->value = tstr;
 	myself->value.svalue->vlen  = len;
+	myself->value.svalue->capacity = len;
+	ctr_utf8_forget(myself->value.svalue);
 	return myself;
 }
 
@@ -2042,7 +2246,7 @@ ctr_object* ctr_string_last_index_of(ctr_object* myself, ctr_argument* argumentL
 	char* p = ctr_internal_memmem( myself->value.svalue->value, hlen, sub->value.svalue->value, nlen, 1 );
 	if (p == NULL) return ctr_build_nil();
 	byte_index = (ctr_size) ( p - (myself->value.svalue->value) );
-	uchar_index = ctr_getutf8len(myself->value.svalue->value, byte_index);
+	uchar_index = ctr_utf8_position(myself->value.svalue, byte_index);
 	return ctr_build_number_from_float((float) uchar_index + 1);
 }
 
@@ -2128,6 +2332,8 @@ ctr_object* ctr_string_replace_with(ctr_object* myself, ctr_argument* argumentLi
 	ctr_heap_free( myself->value.svalue->value );
 	myself->value.svalue->value = odest;
 	myself->value.svalue->vlen  = dlen;
+	myself->value.svalue->capacity = dlen;
+	ctr_utf8_forget(myself->value.svalue);
 	return myself;
 }
 
@@ -2198,6 +2404,8 @@ ctr_object* ctr_string_trim(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_heap_free( myself->value.svalue->value );
 	myself->value.svalue->value = tstr;
 	myself->value.svalue->vlen  = tlen;
+	myself->value.svalue->capacity = tlen;
+	ctr_utf8_forget(myself->value.svalue);
 	return myself;
 }
 
@@ -2457,13 +2665,13 @@ ctr_object* ctr_block_run(ctr_object* myself, ctr_argument* argList, ctr_object*
 	ctr_tnode* parameter;
 	ctr_object* a;
 	int sticky;
-	ctr_open_context();
+	ctr_open_context(node->scope);
 	if (parameterList && parameterList->node) {
 		parameter = parameterList->node;
 		while(argList != NULL) {
 			if (parameter && argList->object) {
 				a = argList->object;
-				ctr_assign_value_to_local(ctr_build_string(parameter->value, parameter->vlen), a);
+				ctr_assign_value_to_slot(parameter->slot, parameter->symbol, a);
 			}
 			if (!argList->next) break;
 			argList = argList->next;
@@ -2474,10 +2682,10 @@ ctr_object* ctr_block_run(ctr_object* myself, ctr_argument* argList, ctr_object*
 	}
 	if (my) {
 		/* me should always point to object, otherwise you have to store me in self and cant use in if */
-		ctr_assign_value_to_local(ctr_build_string_from_cstring( ctr_clex_keyword_me_icon ), my );
-		ctr_assign_value_to_local(ctr_build_string_from_cstring( ctr_clex_keyword_my_icon ), my );
+		ctr_assign_value_to_slot( CTR_SLOT_ME + 1, CtrSymbolMe, my );
+		ctr_assign_value_to_slot( CTR_SLOT_MY + 1, CtrSymbolMy, my );
 	}
-	ctr_assign_value_to_local(ctr_build_string_from_cstring( CTR_DICT_CURRENT_TASK ), myself ); /* otherwise running block may get gc'ed. */
+	ctr_assign_value_to_slot( CTR_SLOT_TASK + 1, CtrSymbolCurrentTask, myself ); /* otherwise running block may get gc'ed. */
 	ctr_cwlk_subprogram++;
 	result = ctr_cwlk_run(codeBlockPart2);
 	ctr_cwlk_subprogram--;
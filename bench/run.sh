@@ -0,0 +1,75 @@
+#!/bin/bash
+#
+# Runs the workloads in bench/ and compares them against a baseline.
+#
+# usage: bench/run.sh [save] [workload ...]
+#
+# For each workload the runner reports the best wall time of BENCH_RUNS
+# runs, the highest amount of allocated memory and the number of minor
+# and major collections. 'save' stores the results as the new baseline.
+# Run from the root of the repository after building (the json workload
+# needs the media test plugin: NAME="libctrmedia.so" make testplugin).
+#
+
+CTR="${CTR:-./ctr}"
+BENCH_RUNS="${BENCH_RUNS:-3}"
+BENCH_BASELINE="${BENCH_BASELINE:-bench/baseline.txt}"
+CITRINE_MEMORY_LIMIT_MB="${BENCH_MEMORY_LIMIT_MB:-512}"
+export CITRINE_MEMORY_LIMIT_MB
+
+SAVE=0
+if [[ "$1" == "save" ]]; then
+	SAVE=1
+	shift
+fi
+
+WORKLOADS="$@"
+if [[ -z "$WORKLOADS" ]]; then
+	WORKLOADS=$(ls bench/*.ctr | xargs -n1 basename | sed 's/\.ctr$//')
+fi
+
+FOOTER='
+>> benchMemory := Program memory.
+Out write: [`@bench `] + (benchMemory ? 9) + [` `] + ((benchMemory ? 7) ? 1) + [` `] + ((benchMemory ? 7) ? 2), stop.
+'
+FOOTER="${FOOTER//\`/\'}"
+
+RESULTS=$(mktemp)
+printf "%-12s %10s %10s %12s %8s %8s %10s\n" "workload" "ms" "baseline" "peak bytes" "minor" "major" "change"
+for name in $WORKLOADS; do
+	program="/tmp/ctrbench-$name.ctr"
+	cat "bench/$name.ctr" > "$program"
+	echo "$FOOTER" >> "$program"
+	best=""
+	stats=""
+	for (( run = 0; run < BENCH_RUNS; run++ )); do
+		start=$(date +%s%N)
+		output=$("$CTR" "$program" 2>&1)
+		end=$(date +%s%N)
+		ms=$(( (end - start) / 1000000 ))
+		stats=$(echo "$output" | grep "^@bench " | tr -d ',' | cut -d' ' -f2-)
+		if [[ -z "$stats" ]]; then
+			echo "$name failed:"
+			echo "$output" | tail -n 5
+			continue 2
+		fi
+		if [[ -z "$best" || $ms -lt $best ]]; then
+			best=$ms
+		fi
+	done
+	rm -f "$program"
+	read peak minor major <<< "$stats"
+	echo "$name $best $peak $minor $major" >> "$RESULTS"
+	baseline=$(grep "^$name " "$BENCH_BASELINE" 2>/dev/null | cut -d' ' -f2)
+	change="-"
+	if [[ -n "$baseline" && $baseline -gt 0 ]]; then
+		change=$(awk "BEGIN { printf \"%+.1f%%\", ($best - $baseline) * 100 / $baseline }")
+	fi
+	printf "%-12s %10s %10s %12s %8s %8s %10s\n" "$name" "$best" "${baseline:--}" "$peak" "$minor" "$major" "$change"
+done
+
+if [[ $SAVE == 1 ]]; then
+	cp "$RESULTS" "$BENCH_BASELINE"
+	echo "baseline saved to $BENCH_BASELINE"
+fi
+rm -f "$RESULTS"
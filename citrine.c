@@ -55,6 +55,19 @@ int ctr_cli_read_args(int argc, char* argv[]) {
 		ctr_cli_welcome();
 		exit(0);
 	}
+	/* -b runs the program on the bytecode machine, the switch is hidden from the program itself */
+	if (strncmp(argv[1],"-b", 2)==0 && strlen(argv[1]) == 2) {
+		if (argc == 2) {
+			ctr_cli_welcome();
+			exit(0);
+		}
+		ctr_vm_mode = 1;
+		argv[1] = argv[0];
+		argv++;
+		argc--;
+		ctr_argv = argv;
+		ctr_argc = argc;
+	}
 	
 	if (strncmp(argv[1],"-g", 2)==0) {
 		if (argc < 4) {
@@ -89,7 +102,6 @@ int ctr_init() {
 	ctr_in_message = 0;
 	ctr_callstack_index = 0;
 	ctr_sandbox_steps = 0;
-	ctr_source_map_head = NULL;
 	ctr_source_mapping = 0;
 	CtrStdFlow = NULL;
 	ctr_source_mapping = 1;
@@ -108,6 +120,7 @@ int ctr_init() {
 	ctr_clex_keyword_assignment_len = strlen( CTR_DICT_ASSIGN );
 	ctr_clex_keyword_return_len = strlen( CTR_DICT_RETURN );
 	ctr_clex_param_prefix_char = CTR_DICT_PARAMETER_PREFIX[0];
+	ctr_clex_initialize();
 	ctr_gc_memlimit = 64 * 1000000; /* Default memory limit: 64MB */
 	ctr_gc_mode = 1;                /* Default GC mode: regular GC, no pool. */
 	return 0;
@@ -125,6 +138,7 @@ void emloop() {
 	init_embedded_media_plugin(); //contains emloop calls so must be here
 	ctr_cwlk_run(program);
 	ctr_gc_sweep(1);
+	ctr_symbol_free_all();
 	ctr_heap_free_rest();
 	if ( ctr_gc_alloc != 0 ) {
 		fprintf( stderr, "[WARNING] Citrine has detected an internal memory leak of: %" PRIu64 " bytes.\n", ctr_gc_alloc );
@@ -159,20 +173,26 @@ int main(int argc, char* argv[]) {
 	//Advanced parameters - environment
 	char* env_param_citrine_memory_limit_mb   = getenv("CITRINE_MEMORY_LIMIT_MB");   // - memory limit in MB
 	char* env_param_citrine_memory_mode       = getenv("CITRINE_MEMORY_MODE");       // - GC mode
+	char* env_param_citrine_profile           = getenv("CITRINE_PROFILE");           // - profiler output (folded stacks)
 	if (env_param_citrine_memory_limit_mb)   ctr_gc_memlimit = atoi(env_param_citrine_memory_limit_mb) * 1000000;
-	if (env_param_citrine_memory_mode)       ctr_gc_mode = atoi(env_param_citrine_memory_mode);
+	if (env_param_citrine_memory_mode) {
+		ctr_gc_mode = atoi(env_param_citrine_memory_mode);
+		ctr_gc_mode_chosen = 1;
+	}
 	program = ctr_cparse_parse(prg, ctr_mode_input_file);
 	if (program == NULL) {
 		fwrite(CtrStdFlow->value.svalue->value, CtrStdFlow->value.svalue->vlen, 1, stderr);
 		exit(1);
 	}
 	ctr_initialize_world();
+	if (env_param_citrine_profile)           ctr_profile_start(env_param_citrine_profile);
 	#ifdef __EMSCRIPTEN__
 	chdir("/persist");
 	emscripten_set_main_loop(emloop, 0, 0);
 	#else
 	ctr_cwlk_run(program);
 	ctr_gc_sweep(1);
+	ctr_symbol_free_all();
 	ctr_heap_free( prg );
 	ctr_heap_free_rest();
 	//For memory profiling
@@ -17,6 +17,14 @@
 #include <locale.h>
 #include "siphash.h"
 #include <sys/stat.h>
+#include <signal.h>
+
+/**
+ * Vectorized substring search, selected at runtime (see ctr_internal_memmem).
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define CTR_MEMMEM_X86
+#endif
 
 #ifdef WIN
 	#include <windows.h>
@@ -29,6 +37,7 @@
 	#include <termios.h>
 	#include <sys/wait.h>
 	#include <dlfcn.h>
+	#include <sys/time.h>
 	#define CTR_DIRSEP "/"
 	#define CTR_ERR errno
 	#define CTR_NEWLINE "\n"
@@ -74,6 +83,16 @@
 #define CTR_TOKEN_RET 16
 #define CTR_TOKEN_FIN 99
 
+/**
+ * Byte classes of the lexer, derived from the dictionary
+ * (see ctr_clex_initialize).
+ */
+#define CTR_CLEX_CLASS_SPACE 1     /* white space */
+#define CTR_CLEX_CLASS_DELIMITER 2 /* always ends a reference */
+#define CTR_CLEX_CLASS_KEYWORD 4   /* might start a keyword or the parameter prefix */
+#define CTR_CLEX_CLASS_SEPARATOR 8 /* might start a number separator */
+#define CTR_CLEX_CLASS_STRING 16   /* needs attention inside a string */
+
 /**
  * Define the UTF8 byte patterns
  */
@@ -139,6 +158,8 @@
 
 #define CTR_MAX_STEPS_LIMIT 2000
 
+#define CTR_NUMBER_FORMAT_SIZE 100
+
 /**
  * Define basic types for Citrine
  */
@@ -150,20 +171,42 @@ typedef  size_t ctr_size;
 
 /**
  * Internal Citrine String
+ * capacity is the size of the buffer (see ctr_internal_string_reserve).
+ * ulen caches the number of characters and index the byte offsets of
+ * every CTR_UTF8_INDEX_STEP characters (see ctr_utf8_length and
+ * ctr_utf8_offset), call ctr_utf8_forget after changing the contents.
  */
+#define CTR_STRING_MIN_CAPACITY 16
+#define CTR_UTF8_INDEX_STEP 64
 struct ctr_string {
 	char* value;
 	ctr_size vlen;
+	ctr_size capacity;
+	ctr_size ulen;
+	ctr_size* index;
+	unsigned int counted: 1;
+	unsigned int ascii: 1;
 };
 typedef struct ctr_string ctr_string;
 
 
 /**
  * Map 
+ * modifications counts the items added, removed and moved, so iterations
+ * over the live list of items can detect changes made underneath them,
+ * iterations counts the iterations in progress.
  */
+#define CTR_MAP_INDEX_THRESHOLD 16
 struct ctr_map {
 	struct ctr_mapitem* head;
+	struct ctr_mapitem* tail;
+	struct ctr_mapitem** index;
 	ctr_size size;
+	ctr_size capacity;
+	ctr_size used;
+	ctr_size shadowed;
+	ctr_size modifications;
+	ctr_size iterations;
 };
 typedef struct ctr_map ctr_map;
 
@@ -192,14 +235,19 @@ typedef struct ctr_argument ctr_argument;
  * Root Object
  */
 struct ctr_object {
-	ctr_map* properties;
-	ctr_map* methods;
+	ctr_map* properties; /* NULL until the first property is added */
+	ctr_map* methods; /* NULL until the first method is added */
 	struct {
 		unsigned int type: 4;
 		unsigned int mark: 1;
 		unsigned int sticky: 1;
 		unsigned int chainMode: 1;
 		unsigned int selfbind: 1;
+		unsigned int symbol: 1;
+		unsigned int constant: 1;
+		unsigned int old: 1;
+		unsigned int remembered: 1;
+		unsigned int keyed: 1; /* has been the key of an inline cache entry */
 	} info;
 	struct ctr_object* link;
 	union uvalue {
@@ -215,6 +263,18 @@ struct ctr_object {
 };
 typedef struct ctr_object ctr_object;
 
+/**
+ * Symbol
+ * Interned string object shared by all AST nodes that refer to
+ * the same selector or variable name, its hash is computed once.
+ */
+struct ctr_symbol {
+	ctr_object object;
+	ctr_string string;
+	uint64_t hash;
+};
+typedef struct ctr_symbol ctr_symbol;
+
 /**
  * Citrine Resource
  */
@@ -236,9 +296,43 @@ struct ctr_collection {
 };
 typedef struct ctr_collection ctr_collection;
 
+/**
+ * Sort Item
+ * Pairs an element of a list with the key it is ordered by,
+ * for sort-by: the key is computed once for every element.
+ */
+struct ctr_sort_item {
+	struct ctr_object* key;
+	struct ctr_object* value;
+};
+typedef struct ctr_sort_item ctr_sort_item;
+
+
+/**
+ * Inline Cache
+ * Maps the start of a method lookup (the receiver itself if it has
+ * methods of its own, otherwise its prototype) to the method found,
+ * one cache per message node. Entries are only valid for the method
+ * epoch they have been filled in.
+ */
+#define CTR_INLINE_CACHE_SIZE 4
+struct ctr_inline_cache_entry {
+	struct ctr_object* key;
+	struct ctr_object* method;
+};
+typedef struct ctr_inline_cache_entry ctr_inline_cache_entry;
+
+struct ctr_inline_cache {
+	uint64_t epoch;
+	uint8_t  next;
+	ctr_inline_cache_entry entries[CTR_INLINE_CACHE_SIZE];
+};
+typedef struct ctr_inline_cache ctr_inline_cache;
 
 /**
  * AST Node
+ * Line (1-based) and column of a node refer to the program it has
+ * been parsed from, line 0 means the position is unknown (evaluated code).
  */
 struct ctr_tnode {
 	int type;
@@ -246,9 +340,36 @@ struct ctr_tnode {
 	char* value;
 	ctr_size vlen;
 	struct ctr_tlistitem* nodes;
+	ctr_inline_cache* cache;
+	struct ctr_object* symbol;
+	struct ctr_object* constant;
+	struct ctr_bytecode* code;
+	struct ctr_scope* scope;
+	int slot;
+	uint32_t line;
+	uint32_t column;
+	char* program;
 };
 typedef struct ctr_tnode ctr_tnode;
 
+/**
+ * Scope
+ * Variables of a block that are kept in the slots of its frame,
+ * determined after parsing (see ctr_cparse_scope): me, my and the
+ * current task, followed by the parameters and the variables declared
+ * with >> in the block itself. A block node points to its scope,
+ * a reference to a variable in a slot points to the scope of the
+ * enclosing block and holds the slot number plus one.
+ */
+#define CTR_SLOT_ME 0
+#define CTR_SLOT_MY 1
+#define CTR_SLOT_TASK 2
+struct ctr_scope {
+	ctr_size count;
+	struct ctr_object** names;
+};
+typedef struct ctr_scope ctr_scope;
+
 /**
  * AST Node List
  */
@@ -258,15 +379,58 @@ struct ctr_tlistitem {
 };
 typedef struct ctr_tlistitem ctr_tlistitem;
 
-struct ctr_source_map {
-	ctr_tnode* node;
-	uint32_t line;
-	struct ctr_source_map* next;
+extern int ctr_source_mapping;
+
+/**
+ * Bytecode
+ * Instruction list of a program or block, compiled from the AST if
+ * the virtual machine is enabled. Operands refer to the constant pool,
+ * jumps are absolute instruction offsets.
+ */
+#define CTR_OP_STRING       1
+#define CTR_OP_NUMBER       2
+#define CTR_OP_BLOCK        3
+#define CTR_OP_TRUE         4
+#define CTR_OP_FALSE        5
+#define CTR_OP_NIL          6
+#define CTR_OP_REFERENCE    7
+#define CTR_OP_ASSIGN_BEGIN 8
+#define CTR_OP_ASSIGN       9
+#define CTR_OP_MSG_BEGIN    10
+#define CTR_OP_RECV_REF     11
+#define CTR_OP_RECV         12
+#define CTR_OP_MSG_NEXT     13
+#define CTR_OP_ARG_BEGIN    14
+#define CTR_OP_ARG_END      15
+#define CTR_OP_SEND         16
+#define CTR_OP_MSG_END      17
+#define CTR_OP_WALK         18
+#define CTR_OP_STATEMENT    19
+#define CTR_OP_RETURN       20
+#define CTR_OP_HALT         21
+
+struct ctr_instruction {
+	uint8_t  opcode;
+	uint8_t  modifier;
+	uint32_t operand;
+	uint32_t jump;
 };
-typedef struct ctr_source_map ctr_source_map;
+typedef struct ctr_instruction ctr_instruction;
 
-extern ctr_source_map* ctr_source_map_head;
-extern int ctr_source_mapping;
+struct ctr_constant {
+	ctr_tnode* node;
+};
+typedef struct ctr_constant ctr_constant;
+
+struct ctr_bytecode {
+	ctr_instruction* instructions;
+	ctr_constant* constants;
+	uint32_t length;
+	uint32_t constant_count;
+	uint32_t stack_size;
+	uint32_t frame_count;
+};
+typedef struct ctr_bytecode ctr_bytecode;
 
 /**
  * Core Objects
@@ -283,6 +447,7 @@ extern ctr_object* CtrStdConsole;
 extern ctr_object* CtrStdNil;
 extern ctr_object* CtrStdGC;
 extern ctr_object* CtrStdMap;
+extern ctr_object* CtrStdBuffer;
 extern ctr_object* CtrStdArray;
 extern ctr_object* CtrStdFile;
 extern ctr_object* CtrStdSystem;
@@ -296,6 +461,7 @@ extern ctr_object* CtrStdSlurp;
 extern ctr_object* CtrStdPath;
 extern ctr_object* CtrStdShellCommand;
 extern ctr_object* ctr_first_object;
+extern ctr_object* ctr_first_young;
 extern ctr_object* ctr_gc_watch_object; // for debug purposes
 extern int ctr_gc_clean_free; // for debug purposes
 
@@ -326,6 +492,8 @@ extern void ctr_cli_welcome();
  * Lexer functions
  */
 extern void 	ctr_clex_load(char* prg);
+extern void 	ctr_clex_initialize();
+extern uint8_t	ctr_clex_class[256];
 extern int 	ctr_clex_tok();
 extern char*  ctr_clex_code_pointer();
 extern char* 	ctr_clex_tok_value();
@@ -357,6 +525,7 @@ extern void ctr_clex_set_ignore_modes( int ignore );
 extern ctr_size ctr_clex_len;
 extern ctr_size ctr_program_length;
 extern int ctr_clex_line_number;
+extern uint32_t ctr_clex_column();
 extern char* ctr_eofcode;
 
 /**
@@ -365,6 +534,12 @@ extern char* ctr_eofcode;
 extern ctr_size getBytesUtf8(char* strval, long startByte, ctr_size lenUChar);
 extern ctr_size ctr_getutf8len(char* strval, ctr_size max);
 extern int ctr_utf8size(char c);
+extern ctr_size ctr_utf8_length(ctr_string* s);
+extern ctr_size ctr_utf8_offset(ctr_object* string, ctr_size n);
+extern ctr_size ctr_utf8_position(ctr_string* s, ctr_size byte_index);
+extern void ctr_utf8_forget(ctr_string* s);
+extern void ctr_utf8_register(ctr_string* s);
+extern void ctr_utf8_drop(size_t from, size_t to);
 
 /**
  * Parser functions
@@ -385,8 +560,20 @@ extern void ctr_translate_generate_dicts(char* hfile1, char* hfile2);
 extern uint64_t    ctr_cwlk_subprogram;
 extern ctr_object* ctr_cwlk_run(ctr_tnode* program);
 extern ctr_object* ctr_cwlk_expr(ctr_tnode* node, char* wasReturn);
+extern int ctr_cwlk_source_line(ctr_tnode* node, char** program);
 extern ctr_tnode* ctr_cparse_block();
+extern void       ctr_cparse_scope(ctr_tnode* node, ctr_scope* scope);
+extern ctr_scope* ctr_cparse_scope_block(ctr_tnode* block);
 extern ctr_tnode* ctr_cparse_create_node( int type );
+extern void ctr_cparse_message_selector(ctr_tnode* m, char* msg, ctr_size msgpartlen);
+
+/**
+ * Bytecode compiler and virtual machine functions
+ */
+extern int           ctr_vm_mode;
+extern void          ctr_vm_compile_program(ctr_tnode* program);
+extern ctr_bytecode* ctr_vm_compile_expression(ctr_tnode* node);
+extern ctr_object*   ctr_vm_run(ctr_bytecode* code);
 
 /**
  * Internal World functions
@@ -394,10 +581,19 @@ extern ctr_tnode* ctr_cparse_create_node( int type );
 extern int ctr_in_message;
 extern void        ctr_initialize_world();
 extern char*       ctr_internal_memmem(char* haystack, long hlen, char* needle, long nlen, int reverse );
+extern char*       ctr_internal_memmem_scalar(char* haystack, long hlen, char* needle, long nlen, int reverse );
+extern char*       (*ctr_internal_memmem_impl)(char* haystack, long hlen, char* needle, long nlen, int reverse );
+extern void        ctr_internal_memmem_select();
+#ifdef CTR_MEMMEM_X86
+extern char*       ctr_internal_memmem_sse2(char* haystack, long hlen, char* needle, long nlen, int reverse );
+extern char*       ctr_internal_memmem_avx2(char* haystack, long hlen, char* needle, long nlen, int reverse );
+#endif
 extern void        ctr_internal_object_add_property(ctr_object* owner, ctr_object* key, ctr_object* value, int m);
 extern void        ctr_internal_object_set_property(ctr_object* owner, ctr_object* key, ctr_object* value, int is_method);
 extern void        ctr_internal_object_delete_property(ctr_object* owner, ctr_object* key, int is_method);
 extern ctr_object* ctr_internal_object_find_property(ctr_object* owner, ctr_object* key, int is_method);
+extern ctr_mapitem* ctr_internal_map_find_key(ctr_map* map, char* key, ctr_size length, uint64_t hashKey);
+extern void        ctr_internal_map_promote(ctr_map* map, ctr_mapitem* item);
 extern ctr_object* ctr_internal_object_property(ctr_object* owner, char* keystr, ctr_object* value);
 extern double ctr_tonum(ctr_object* o);
 extern char ctr_tobool(ctr_object* o);
@@ -406,6 +602,9 @@ extern void        ctr_internal_object_add_property(ctr_object* owner, ctr_objec
 extern ctr_object* ctr_internal_cast2bool( ctr_object* o );
 extern ctr_object* ctr_internal_cast2number(ctr_object* o);
 extern ctr_object* ctr_internal_create_object(int type);
+extern ctr_object* ctr_internal_create_constant(int type);
+extern ctr_object* ctr_internal_constant(ctr_tnode* node);
+extern ctr_object* ctr_internal_constant_clone(ctr_object* o);
 extern ctr_object* ctr_internal_cast2string( ctr_object* o );
 extern ctr_object* ctr_internal_copy2string( ctr_object* o );
 extern void*       ctr_internal_plugin_find( ctr_object* key );
@@ -414,21 +613,41 @@ extern ctr_object* ctr_find_in_my(ctr_object* key);
 extern ctr_object* ctr_assign_value(ctr_object* key, ctr_object* val);
 extern ctr_object* ctr_assign_value_to_my(ctr_object* key, ctr_object* val);
 extern ctr_object* ctr_assign_value_to_local(ctr_object* key, ctr_object* val);
+extern ctr_object* ctr_assign_value_to_slot(int slot, ctr_object* key, ctr_object* val);
+extern ctr_object* ctr_find_variable(ctr_tnode* ref);
+extern ctr_object* ctr_assign_variable(ctr_tnode* ref, ctr_object* val);
+extern ctr_object* ctr_assign_local_variable(ctr_tnode* ref, ctr_object* val);
+extern int         ctr_scope_find(ctr_scope* scope, ctr_object* key);
 extern char*       ctr_internal_readf(char* file_name, uint64_t* size_allocated);
 extern void        ctr_internal_export_tree(ctr_tnode* ti);
 extern ctr_object* ctr_send_message(ctr_object* receiver, char* message, long len, ctr_argument* argumentList);
+extern ctr_object* ctr_send_message_symbol(ctr_object* receiver, ctr_object* selector, ctr_argument* argumentList, ctr_inline_cache* cache);
+extern uint64_t    ctr_method_epoch;
+extern ctr_object* ctr_symbol_intern(char* name, ctr_size vlen);
+extern void        ctr_symbol_free_all();
+extern void        ctr_internal_symbols_initialize();
+extern ctr_object* CtrSymbolMe;
+extern ctr_object* CtrSymbolMy;
+extern ctr_object* CtrSymbolCurrentTask;
 extern void ctr_internal_create_func(ctr_object* o, ctr_object* key, ctr_object* (*func)( ctr_object*, ctr_argument* ) );
 
 /**
  * Scoping functions
  */
-extern void ctr_open_context();
+extern void ctr_open_context(ctr_scope* scope);
 extern void ctr_close_context();
+extern ctr_object* ctr_context_object();
 
 /**
  * Global Scoping variables
  */
 extern ctr_object* ctr_contexts[301];
+extern ctr_size ctr_context_roots[301];
+extern ctr_scope* ctr_context_scope[301];
+extern ctr_size ctr_context_frame[301];
+extern ctr_object** ctr_slots;
+extern ctr_size ctr_slots_count;
+extern ctr_size ctr_slots_capacity;
 extern int ctr_context_id;
 extern ctr_tnode* ctr_callstack[301];
 extern uint8_t ctr_callstack_index;
@@ -523,6 +742,7 @@ extern ctr_object* ctr_number_max(ctr_object* myself, ctr_argument* argumentList
 extern ctr_object* ctr_number_odd(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_number_even(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_number_to_string(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_size ctr_internal_number_format(ctr_number n, char* buffer);
 extern ctr_object* ctr_number_to_string_flat(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_number_to_boolean(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_number_between(ctr_object* myself, ctr_argument* argumentList);
@@ -590,6 +810,17 @@ extern ctr_object* ctr_string_copy(ctr_object* myself, ctr_argument* argumentLis
 extern ctr_object* ctr_string_to_code(ctr_object* myself, ctr_argument* ctr_argumentList);
 extern ctr_object* ctr_string_minus(ctr_object* myself, ctr_argument* ctr_argumentList);
 extern ctr_object* ctr_string_bytes(ctr_object* myself, ctr_argument* ctr_argumentList);
+extern void ctr_internal_string_reserve(ctr_string* s, ctr_size size);
+extern void ctr_internal_string_append(ctr_string* s, char* value, ctr_size vlen);
+
+/**
+ * Buffer Interface
+ */
+extern ctr_object* ctr_buffer_new(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_buffer_type(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_buffer_append(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_buffer_to_string(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_buffer_flush(ctr_object* myself, ctr_argument* argumentList);
 
 
 /**
@@ -620,6 +851,8 @@ extern ctr_object* ctr_array_join(ctr_object* myself, ctr_argument* argumentList
 extern ctr_object* ctr_array_pop(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_array_get(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_array_sort(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_array_sort_natural(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_array_sort_by(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_array_put(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_array_from_length(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_array_splice(ctr_object* myself, ctr_argument* argumentList);
@@ -646,6 +879,7 @@ extern ctr_object* ctr_map_type(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_put(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_get(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_count(ctr_object* myself, ctr_argument* argumentList);
+extern ctr_object* ctr_map_copy(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_each(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_to_string(ctr_object* myself, ctr_argument* argumentList);
 extern ctr_object* ctr_map_delete(ctr_object* myself, ctr_argument* argumentList);
@@ -788,8 +1022,33 @@ extern int ctr_gc_object_counter;
 extern int ctr_gc_kept_counter;
 extern int ctr_gc_sticky_counter;
 extern int ctr_gc_mode;
+extern int ctr_gc_mode_chosen;
+extern int ctr_gc_young_counter;
+extern int ctr_gc_minor_counter;
+extern int ctr_gc_major_counter;
+extern double ctr_gc_minor_pause;
+extern double ctr_gc_major_pause;
+extern void ctr_gc_write_barrier(ctr_object* owner, ctr_object* value);
+extern void ctr_gc_internal_collect_young();
+
+/**
+ * Number of objects that can be allocated in the young generation
+ * before a minor collection is triggered.
+ */
+#define CTR_GC_NURSERY_SIZE 8192
+
+/**
+ * Maximum number of entries of the mark stack, and the number of
+ * objects scanned per slice of an incremental major collection.
+ */
+#define CTR_GC_MARK_STACK_LIMIT 65536
+#define CTR_GC_SLICE 4096
+
+extern int ctr_gc_marking;
+extern void ctr_gc_internal_collect_slice( ctr_size budget );
 
 extern uint64_t ctr_gc_alloc;
+extern uint64_t ctr_gc_alloc_peak;
 extern uint64_t ctr_gc_memlimit;
 
 /**
@@ -801,16 +1060,30 @@ extern ctr_object* ctr_build_block(ctr_tnode* node);
 extern ctr_object* ctr_build_number(char* object);
 extern ctr_object* ctr_build_number_from_string(char* fixedStr, ctr_size strLength, char international);
 extern ctr_object* ctr_build_number_from_float(ctr_number floatNumber);
+extern ctr_object* ctr_build_small_number(ctr_number floatNumber);
+
+/**
+ * Range of the shared small integers returned by arithmetic.
+ */
+#define CTR_SMALL_NUMBER_MIN -128
+#define CTR_SMALL_NUMBER_MAX 1024
 extern ctr_object* ctr_build_bool(int truth);
 extern ctr_object* ctr_build_nil();
 extern ctr_object* ctr_build_string_from_cstring( char* str );
 extern void ctr_gc_internal_collect();
 extern ctr_object* ctr_gc_internal_pin( ctr_object* object );
+extern ctr_size ctr_gc_internal_roots();
+extern void ctr_gc_internal_unpin( ctr_size height );
 extern ctr_object* ctr_gc_memory(ctr_object* myself, ctr_argument* argumentList);
 
 
+#define CTR_HEAP_ARENA_MIN 4096
+#define CTR_HEAP_ARENA_MAX 262144
 extern void* ctr_heap_allocate( size_t size );
 extern void* ctr_heap_allocate_tracked( size_t size );
+extern void* ctr_heap_allocate_arena( size_t size );
+extern void  ctr_heap_arena_close();
+extern void* ctr_heap_track( void* space, size_t size );
 extern void  ctr_heap_free( void* ptr );
 extern void  ctr_heap_free_rest();
 extern void* ctr_heap_reallocate(void* oldptr, size_t size );
@@ -829,6 +1102,26 @@ extern ctr_object* ctr_error( char* error_string, uint16_t error_code );
 extern ctr_object* ctr_error_text( char* error_string );
 extern void ctr_pool_init( ctr_size pool );
 
+/**
+ * Size classes of the slab allocator,
+ * blocks up to CTR_POOL_CLASSES * CTR_POOL_CLASS_WIDTH bytes are pooled.
+ */
+#define CTR_POOL_CLASS_WIDTH 16
+#define CTR_POOL_CLASSES 16
+#define CTR_POOL_SLAB_SIZE 65536
+
+struct ctr_pool_class {
+	char* free;
+	char* cursor;
+	char* end;
+	uint64_t used;
+	uint64_t available;
+	uint64_t slabs;
+};
+typedef struct ctr_pool_class ctr_pool_class;
+
+extern ctr_pool_class ctr_pools[CTR_POOL_CLASSES];
+
 extern char ctr_deserialize_mode;
 
 extern char ctr_program_log_type;
@@ -839,6 +1132,60 @@ extern void ctr_print_error(char* error, int code);
 
 size_t ctr_heap_tracker_memoryblocknumber();
 size_t ctr_heap_tracker_rewind( size_t memoryBlockNumber );
+size_t ctr_heap_tracker_size( size_t memoryBlockNumber );
+void ctr_heap_tracker_release( size_t from, size_t to );
+int ctr_heap_tracker_owns( void* ptr, size_t from, size_t to );
+
+/**
+ * Parsed programs of Program use: are kept in a cache,
+ * an entry is valid as long as the file on disk has not changed.
+ */
+struct ctr_program_cache_entry {
+	char* path;
+	uint64_t device;
+	uint64_t inode;
+	uint64_t size;
+	int64_t mtime;
+	int64_t mtime_nsec;
+	ctr_tnode* program;
+	size_t memblock;
+	size_t memend;
+	size_t bytes;
+	struct ctr_program_cache_entry* next;
+};
+typedef struct ctr_program_cache_entry ctr_program_cache_entry;
+
+extern ctr_program_cache_entry* ctr_program_cache;
+extern uint64_t ctr_program_cache_hits;
+extern uint64_t ctr_program_cache_misses;
+extern uint64_t ctr_program_cache_bytes;
+extern ctr_tnode* ctr_program_cache_get( char* path );
+extern void ctr_program_cache_put( char* path, ctr_tnode* program, size_t memblock );
+extern void ctr_program_cache_release( ctr_program_cache_entry* entry );
+extern void ctr_program_cache_rewind( size_t memoryBlockNumber );
+
+/**
+ * Sampling profiler (CITRINE_PROFILE), the timer sets the tick flag,
+ * the next message send takes the sample.
+ */
+#define CTR_PROFILE_INTERVAL 1000
+struct ctr_profile_entry {
+	ctr_tnode* node;
+	char* text;
+	uint64_t count;
+};
+typedef struct ctr_profile_entry ctr_profile_entry;
+struct ctr_profile_table {
+	ctr_profile_entry* entries;
+	ctr_size size;
+	ctr_size count;
+};
+typedef struct ctr_profile_table ctr_profile_table;
+extern volatile sig_atomic_t ctr_profile_tick;
+extern void ctr_profile_start( char* path );
+extern void ctr_profile_sample();
+extern void ctr_profile_write();
+extern void ctr_profile_rewind();
 
 extern int putenv_old(const char* name, const char* value);
 
@@ -58,7 +58,8 @@ ctr_object* ctr_array_push(ctr_object* myself, ctr_argument* argumentList) {
 			(sizeof(ctr_object*) * (myself->value.avalue->length))
 		);
 	}
-	pushValue = argumentList->object;
+	pushValue = ctr_internal_constant_clone(argumentList->object);
+	ctr_gc_write_barrier(myself, pushValue);
 	*(myself->value.avalue->elements + myself->value.avalue->head) = pushValue;
 	myself->value.avalue->head++;
 	return myself;
@@ -126,6 +127,7 @@ ctr_object* ctr_array_map(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* block = argumentList->object;
 	ctr_size i = 0;
 	ctr_size j = 0;
+	ctr_size roots = ctr_gc_internal_roots();
 	if (block->info.type != CTR_OBJECT_TYPE_OTBLOCK) {
 		CtrStdFlow = ctr_error( CTR_ERR_EXP_BLK, 0 );
 		return myself;
@@ -145,6 +147,7 @@ ctr_object* ctr_array_map(ctr_object* myself, ctr_argument* argumentList) {
 		ctr_gc_internal_pin(myself);
 		ctr_gc_internal_pin(argument2->object);
 		ctr_block_run(block, arguments, NULL);
+		ctr_gc_internal_unpin(roots);
 		ctr_heap_free( arguments );
 		ctr_heap_free( argument2 );
 		ctr_heap_free( argument3 );
@@ -179,7 +182,8 @@ ctr_object* ctr_array_new_and_push(ctr_object* myclass, ctr_argument* argumentLi
  * ✎ write: x, stop.
  */
 ctr_object* ctr_array_unshift(ctr_object* myself, ctr_argument* argumentList) {
-	ctr_object* pushValue = argumentList->object;
+	ctr_object* pushValue = ctr_internal_constant_clone(argumentList->object);
+	ctr_gc_write_barrier(myself, pushValue);
 	if (myself->value.avalue->tail > 0) {
 		myself->value.avalue->tail--;
 	} else {
@@ -204,31 +208,27 @@ ctr_object* ctr_array_unshift(ctr_object* myself, ctr_argument* argumentList) {
  */
 ctr_object* ctr_array_join(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_size i;
-	char* result = NULL;
-	ctr_size len = 0;
-	ctr_size pos;
-	ctr_object* o;
+	ctr_string buffer;
 	ctr_object* str;
 	ctr_object* resultStr;
 	ctr_object* glue = ctr_internal_cast2string(argumentList->object);
-	ctr_size glen = glue->value.svalue->vlen;
+	buffer.value = NULL;
+	buffer.vlen = 0;
+	buffer.capacity = 0;
+	buffer.index = NULL;
 	for(i=myself->value.avalue->tail; i<myself->value.avalue->head; i++) {
-		o = *( myself->value.avalue->elements + i );
-		str = ctr_internal_cast2string(o);
-		pos = len;
-		if (i == myself->value.avalue->tail) {
-			len = str->value.svalue->vlen;
-			result = ctr_heap_allocate(sizeof(char)*len);
-		} else {
-			len += str->value.svalue->vlen + glen;
-			result = ctr_heap_reallocate(result, sizeof(char)*len );
-			memcpy(result+pos, glue->value.svalue->value, glen);
-			pos += glen;
+		str = ctr_internal_cast2string( *( myself->value.avalue->elements + i ) );
+		if (i > myself->value.avalue->tail) {
+			ctr_internal_string_append(&buffer, glue->value.svalue->value, glue->value.svalue->vlen);
 		}
-		memcpy(result+pos, str->value.svalue->value, str->value.svalue->vlen);
+		ctr_internal_string_append(&buffer, str->value.svalue->value, str->value.svalue->vlen);
 	}
-	resultStr = ctr_build_string(result, len);
-	if (i > myself->value.avalue->tail) ctr_heap_free( result );
+	/* adopt the buffer, no final copy */
+	resultStr = ctr_build_empty_string();
+	if (buffer.capacity == 0) return resultStr;
+	resultStr->value.svalue->value = buffer.value;
+	resultStr->value.svalue->vlen = buffer.vlen;
+	resultStr->value.svalue->capacity = buffer.capacity;
 	return resultStr;
 }
 
@@ -359,6 +359,8 @@ ctr_object* ctr_array_put(ctr_object* myself, ctr_argument* argumentList) {
 		}
 		myself->value.avalue->tail = putIndexNumber;
 	}
+	putValue = ctr_internal_constant_clone(putValue);
+	ctr_gc_write_barrier(myself, putValue);
 	*(myself->value.avalue->elements + putIndexNumber) = putValue;
 	return myself;
 }
@@ -601,28 +603,116 @@ ctr_object* ctr_array_copy(ctr_object* myself, ctr_argument* argumentList) {
 /**
  * @internal
  *
- * Internal sort function, for use with ArraySort.
- * Interfaces with qsort-compatible function.
+ * Compares two elements for sorting. If a sorter block has been
+ * specified the block decides, using the argument pair provided by
+ * the caller, otherwise numbers and strings are compared in their
+ * natural order (numbers by value, strings byte by byte).
  */
-ctr_object* temp_sorter;
-ctr_object* temp_self;
-int ctr_sort_cmp(const void * a, const void * b) {
-	ctr_argument* arg1 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
-	ctr_argument* arg2 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+int ctr_sort_compare(ctr_object* a, ctr_object* b, ctr_object* sorter, ctr_argument* pair) {
 	ctr_object* result;
-	ctr_object* numResult;
-	arg1->next = arg2;
-	arg1->object = *((ctr_object**) a);
-	arg2->object = *((ctr_object**) b);
-	ctr_gc_internal_pin(temp_sorter);
-	ctr_gc_internal_pin(temp_self);
-	ctr_gc_internal_pin(arg1->object);
-	ctr_gc_internal_pin(temp_self);
-	result = ctr_block_run(temp_sorter, arg1, NULL);
-	numResult = ctr_internal_cast2number(result);
-	ctr_heap_free( arg1 );
-	ctr_heap_free( arg2 );
-	return (int) numResult->value.nvalue;
+	ctr_size len;
+	int cmp;
+	if (sorter) {
+		pair->object = a;
+		pair->next->object = b;
+		result = ctr_block_run(sorter, pair, NULL);
+		return (int) ctr_internal_cast2number(result)->value.nvalue;
+	}
+	if (a->info.type == CTR_OBJECT_TYPE_OTNUMBER) {
+		if (a->value.nvalue < b->value.nvalue) return -1;
+		return (a->value.nvalue > b->value.nvalue);
+	}
+	len = a->value.svalue->vlen;
+	if (b->value.svalue->vlen < len) len = b->value.svalue->vlen;
+	cmp = memcmp(a->value.svalue->value, b->value.svalue->value, len);
+	if (cmp) return cmp;
+	if (a->value.svalue->vlen < b->value.svalue->vlen) return -1;
+	return (a->value.svalue->vlen > b->value.svalue->vlen);
+}
+
+/**
+ * @internal
+ *
+ * Stable merge sort of sort items by key, tmp must have room for
+ * count items. The halves are split and merged in the same order
+ * as the merge sort in libc qsort, so sorter blocks that only answer
+ * true or false keep producing the same order as before.
+ */
+void ctr_sort_merge(ctr_sort_item* items, ctr_sort_item* tmp, ctr_size count, ctr_object* sorter, ctr_argument* pair) {
+	ctr_size n1, n2;
+	ctr_sort_item* b1;
+	ctr_sort_item* b2;
+	ctr_sort_item* out;
+	if (count <= 1) return;
+	n1 = count / 2;
+	n2 = count - n1;
+	b1 = items;
+	b2 = items + n1;
+	ctr_sort_merge(b1, tmp, n1, sorter, pair);
+	ctr_sort_merge(b2, tmp, n2, sorter, pair);
+	out = tmp;
+	while (n1 > 0 && n2 > 0) {
+		if (ctr_sort_compare(b1->key, b2->key, sorter, pair) <= 0) {
+			*out++ = *b1++;
+			n1--;
+		} else {
+			*out++ = *b2++;
+			n2--;
+		}
+	}
+	if (n1 > 0) memcpy(out, b1, n1 * sizeof(ctr_sort_item));
+	memcpy(items, tmp, (count - n2) * sizeof(ctr_sort_item));
+}
+
+/**
+ * @internal
+ *
+ * Sorts the items and stores the values back into the list.
+ * Items are sorted in a buffer of their own, the sorter block
+ * might change the list in the meantime, in that case the
+ * list is left as it is.
+ */
+void ctr_sort_items(ctr_object* list, ctr_sort_item* items, ctr_size count, ctr_object* sorter) {
+	ctr_sort_item* tmp;
+	ctr_argument* pair = NULL;
+	ctr_size i;
+	if (sorter) {
+		pair = ctr_heap_allocate(sizeof(ctr_argument));
+		pair->next = ctr_heap_allocate(sizeof(ctr_argument));
+	}
+	tmp = ctr_heap_allocate(count * sizeof(ctr_sort_item));
+	ctr_sort_merge(items, tmp, count, sorter, pair);
+	if (list->value.avalue->head - list->value.avalue->tail == count) {
+		for(i = 0; i < count; i++) {
+			list->value.avalue->elements[list->value.avalue->tail + i] = items[i].value;
+		}
+	}
+	ctr_heap_free(tmp);
+	if (pair) {
+		ctr_heap_free(pair->next);
+		ctr_heap_free(pair);
+	}
+}
+
+/**
+ * @internal
+ *
+ * Verifies that the keys can be sorted in their natural order,
+ * either all numbers or all strings. Sets an error otherwise.
+ */
+int ctr_sort_natural_keys(ctr_sort_item* items, ctr_size count) {
+	ctr_size i;
+	int type;
+	if (count == 0) return 1;
+	type = items[0].key->info.type;
+	if (type != CTR_OBJECT_TYPE_OTNUMBER) type = CTR_OBJECT_TYPE_OTSTRING;
+	for(i = 0; i < count; i++) {
+		if (items[i].key->info.type != type) {
+			CtrStdFlow = ctr_error( (type == CTR_OBJECT_TYPE_OTNUMBER) ? CTR_ERR_EXP_NUM : CTR_ERR_EXP_STR, 0 );
+			return 0;
+		}
+	}
+	return 1;
 }
 
 /**
@@ -636,13 +726,95 @@ int ctr_sort_cmp(const void * a, const void * b) {
  */
 ctr_object* ctr_array_sort(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* sorter = argumentList->object;
+	ctr_collection* list = myself->value.avalue;
+	ctr_size count = list->head - list->tail;
+	ctr_size roots = ctr_gc_internal_roots();
+	ctr_sort_item* items;
+	ctr_size i;
 	if (sorter->info.type != CTR_OBJECT_TYPE_OTBLOCK) {
 		CtrStdFlow = ctr_error( CTR_ERR_EXP_BLK, 0 );
 		return myself;
 	}
-	temp_sorter = sorter;
-	temp_self = myself;
-	qsort((myself->value.avalue->elements+myself->value.avalue->tail), myself->value.avalue->head-myself->value.avalue->tail, sizeof(ctr_object*), ctr_sort_cmp);
+	if (count < 2) return myself;
+	ctr_gc_internal_pin(myself);
+	ctr_gc_internal_pin(sorter);
+	items = ctr_heap_allocate(count * sizeof(ctr_sort_item));
+	for(i = 0; i < count; i++) {
+		items[i].key = items[i].value = ctr_gc_internal_pin(list->elements[list->tail + i]);
+	}
+	ctr_sort_items(myself, items, count, sorter);
+	ctr_heap_free(items);
+	ctr_gc_internal_unpin(roots);
+	return myself;
+}
+
+/**
+ * @def
+ * [ List ] sort
+ *
+ * @example
+ * ☞ x ≔ List ← 3 ; 1 ; 2.
+ * x sort.
+ * ✎ write: x, stop.
+ * ☞ y ≔ List ← ‘pear’ ; ‘apple’ ; ‘fig’.
+ * y sort.
+ * ✎ write: y, stop.
+ */
+ctr_object* ctr_array_sort_natural(ctr_object* myself, ctr_argument* argumentList) {
+	ctr_collection* list = myself->value.avalue;
+	ctr_size count = list->head - list->tail;
+	ctr_sort_item* items;
+	ctr_size i;
+	if (count < 2) return myself;
+	items = ctr_heap_allocate(count * sizeof(ctr_sort_item));
+	for(i = 0; i < count; i++) {
+		items[i].key = items[i].value = list->elements[list->tail + i];
+	}
+	if (ctr_sort_natural_keys(items, count)) {
+		ctr_sort_items(myself, items, count, NULL);
+	}
+	ctr_heap_free(items);
+	return myself;
+}
+
+/**
+ * @def
+ * [ List ] sort-by: [ Block ]
+ *
+ * @example
+ * ☞ x ≔ List ← ‘pear’ ; ‘fig’ ; ‘apple’.
+ * x sort-by: { :word ↲ word length. }.
+ * ✎ write: x, stop.
+ */
+ctr_object* ctr_array_sort_by(ctr_object* myself, ctr_argument* argumentList) {
+	ctr_object* block = argumentList->object;
+	ctr_collection* list = myself->value.avalue;
+	ctr_size count = list->head - list->tail;
+	ctr_size roots = ctr_gc_internal_roots();
+	ctr_argument* arg;
+	ctr_sort_item* items;
+	ctr_size i;
+	if (block->info.type != CTR_OBJECT_TYPE_OTBLOCK) {
+		CtrStdFlow = ctr_error( CTR_ERR_EXP_BLK, 0 );
+		return myself;
+	}
+	if (count < 2) return myself;
+	ctr_gc_internal_pin(myself);
+	ctr_gc_internal_pin(block);
+	items = ctr_heap_allocate(count * sizeof(ctr_sort_item));
+	arg = ctr_heap_allocate(sizeof(ctr_argument));
+	for(i = 0; i < count && CtrStdFlow == NULL; i++) {
+		items[i].value = ctr_gc_internal_pin(list->elements[list->tail + i]);
+		arg->object = items[i].value;
+		items[i].key = ctr_gc_internal_pin(ctr_block_run(block, arg, NULL));
+		if (list->head - list->tail != count) break;
+	}
+	ctr_heap_free(arg);
+	if (i == count && CtrStdFlow == NULL && ctr_sort_natural_keys(items, count)) {
+		ctr_sort_items(myself, items, count, NULL);
+	}
+	ctr_heap_free(items);
+	ctr_gc_internal_unpin(roots);
 	return myself;
 }
 
@@ -778,6 +950,87 @@ ctr_object* ctr_map_type(ctr_object* myself, ctr_argument* argumentList) {
 	return ctr_build_string_from_cstring( CTR_DICT_MAP_OBJECT );
 }
 
+/**
+ * @internal
+ *
+ * Determines whether Number, String and Boolean still use their
+ * own string methods, in that case their map keys can be computed
+ * without sending messages. Rechecked whenever methods change.
+ */
+uint64_t ctr_map_key_epoch = 0;
+int ctr_map_key_native = 0;
+int ctr_map_native_keys() {
+	ctr_object* name;
+	ctr_object* method;
+	if (ctr_map_key_epoch == ctr_method_epoch) return ctr_map_key_native;
+	name = ctr_build_string_from_cstring( CTR_DICT_TOSTRING );
+	ctr_map_key_native = 1;
+	method = ctr_internal_object_find_property(CtrStdNumber, name, 1);
+	if (!method || method->info.type != CTR_OBJECT_TYPE_OTNATFUNC || method->value.fvalue != &ctr_number_to_string) ctr_map_key_native = 0;
+	method = ctr_internal_object_find_property(CtrStdString, name, 1);
+	if (!method || method->info.type != CTR_OBJECT_TYPE_OTNATFUNC || method->value.fvalue != &ctr_object_myself) ctr_map_key_native = 0;
+	method = ctr_internal_object_find_property(CtrStdBool, name, 1);
+	if (!method || method->info.type != CTR_OBJECT_TYPE_OTNATFUNC || method->value.fvalue != &ctr_bool_to_string) ctr_map_key_native = 0;
+	ctr_map_key_epoch = ctr_method_epoch;
+	return ctr_map_key_native;
+}
+
+/**
+ * @internal
+ *
+ * Returns the bytes a plain String, Number or Boolean is stored
+ * under in a map, the same bytes its string message would return.
+ * Numbers are written into the buffer (CTR_NUMBER_FORMAT_SIZE bytes).
+ * Returns NULL for other keys, those need a string message.
+ */
+char* ctr_map_key_bytes(ctr_object* key, char* buffer, ctr_size* length) {
+	char* bytes;
+	/* literal constants carry empty maps, only filled ones count */
+	if (key->methods && key->methods->size) return NULL;
+	if (key->info.type == CTR_OBJECT_TYPE_OTSTRING) {
+		if (key->link != CtrStdString && !key->info.symbol) return NULL;
+		if (!ctr_map_native_keys()) return NULL;
+		*length = key->value.svalue->vlen;
+		return key->value.svalue->value;
+	}
+	if (key->info.type == CTR_OBJECT_TYPE_OTNUMBER) {
+		/* numbers with a qualifier print it as well */
+		if (key->link != CtrStdNumber || (key->properties && key->properties->size)) return NULL;
+		if (!ctr_map_native_keys()) return NULL;
+		*length = ctr_internal_number_format(key->value.nvalue, buffer);
+		return (*length) ? buffer : NULL;
+	}
+	if (key->info.type == CTR_OBJECT_TYPE_OTBOOL) {
+		if (key->link != CtrStdBool) return NULL;
+		if (!ctr_map_native_keys()) return NULL;
+		bytes = key->value.bvalue ? CTR_DICT_TRUE : CTR_DICT_FALSE;
+		*length = strlen(bytes);
+		return bytes;
+	}
+	return NULL;
+}
+
+/**
+ * @internal
+ *
+ * Converts a key to the string it is stored under in a map,
+ * user objects can define their own key by responding to string.
+ */
+ctr_object* ctr_map_key(ctr_object* key) {
+	ctr_object* stringKey;
+	ctr_argument* emptyArgumentList = ctr_heap_allocate(sizeof(ctr_argument));
+	emptyArgumentList->next = NULL;
+	emptyArgumentList->object = NULL;
+	/* Use tostring and not tocode here because tocode will escape quotes, but tostring not, this will preserve the orig key */
+	stringKey = ctr_send_message(key, CTR_DICT_TOSTRING, strlen(CTR_DICT_TOSTRING), emptyArgumentList);
+	ctr_heap_free( emptyArgumentList );
+	/* If developer returns something other than string (ouch, toString), then cast anyway */
+	if (stringKey->info.type != CTR_OBJECT_TYPE_OTSTRING) {
+		stringKey = ctr_internal_cast2string(stringKey);
+	}
+	return stringKey;
+}
+
 /**
  * @def
  * [ Map ] put: [ Object ] at: [ Object ]
@@ -788,27 +1041,34 @@ ctr_object* ctr_map_type(ctr_object* myself, ctr_argument* argumentList) {
  * ✎ write: x, stop.
  */
 ctr_object* ctr_map_put(ctr_object* myself, ctr_argument* argumentList) {
+	char buffer[CTR_NUMBER_FORMAT_SIZE];
 	char* key;
-	long keyLen;
-	ctr_object* putKey;
+	ctr_size keyLen;
+	uint64_t hashKey;
+	ctr_mapitem* item;
+	ctr_object* putKey = argumentList->next->object;
 	ctr_object* putValue = argumentList->object;
-	ctr_argument* nextArgument = argumentList->next;
-	ctr_argument* emptyArgumentList = ctr_heap_allocate(sizeof(ctr_argument));
-	emptyArgumentList->next = NULL;
-	emptyArgumentList->object = NULL;
-	/* Use tostring and not tocode here because tocode will escape quotes, but tostring not, this will preserve the orig key */
-	putKey = ctr_send_message(nextArgument->object, CTR_DICT_TOSTRING, strlen(CTR_DICT_TOSTRING), emptyArgumentList);
-	/* If developer returns something other than string (ouch, toString), then cast anyway */
-	if (putKey->info.type != CTR_OBJECT_TYPE_OTSTRING) {
-		putKey = ctr_internal_cast2string(putKey);
+	ctr_size roots = ctr_gc_internal_roots();
+	key = ctr_map_key_bytes(putKey, buffer, &keyLen);
+	if (key == NULL) {
+		putKey = ctr_map_key(putKey);
+		key = putKey->value.svalue->value;
+		keyLen = putKey->value.svalue->vlen;
+	}
+	hashKey = siphash24(key, keyLen, CtrHashKey);
+	item = ctr_internal_map_find_key(myself->properties, key, keyLen, hashKey);
+	if (item) {
+		putValue = ctr_internal_constant_clone(putValue);
+		ctr_gc_write_barrier(myself, putValue);
+		item->value = putValue;
+		/* during each: an overwrite keeps its place, the iteration goes on */
+		if (!myself->properties->iterations) ctr_internal_map_promote(myself->properties, item);
+	} else {
+		ctr_gc_internal_pin(putKey);
+		ctr_gc_internal_pin(putValue);
+		ctr_internal_object_add_property(myself, ctr_build_string(key, keyLen), putValue, 0);
+		ctr_gc_internal_unpin(roots);
 	}
-	key = ctr_heap_allocate( putKey->value.svalue->vlen * sizeof( char ) );
-	keyLen = putKey->value.svalue->vlen;
-	memcpy(key, putKey->value.svalue->value, keyLen);
-	ctr_internal_object_delete_property(myself, ctr_build_string(key, keyLen), 0);
-	ctr_internal_object_add_property(myself, ctr_build_string(key, keyLen), putValue, 0);
-	ctr_heap_free( emptyArgumentList );
-	ctr_heap_free( key );
 	return myself;
 }
 
@@ -848,7 +1108,17 @@ ctr_object* ctr_map_key_value(ctr_object* myself, ctr_argument* argumentList) {
  * ✎ write: x, stop.
  */
 ctr_object* ctr_map_delete(ctr_object* myself, ctr_argument* argumentList) {
-	ctr_internal_object_delete_property(myself, ctr_internal_cast2string(argumentList->object), 0);
+	char buffer[CTR_NUMBER_FORMAT_SIZE];
+	char* key;
+	ctr_size keyLen;
+	ctr_object* deleteKey = argumentList->object;
+	key = ctr_map_key_bytes(deleteKey, buffer, &keyLen);
+	if (key == NULL) {
+		deleteKey = ctr_internal_cast2string(deleteKey);
+	} else if (deleteKey->info.type != CTR_OBJECT_TYPE_OTSTRING) {
+		deleteKey = ctr_build_string(key, keyLen);
+	}
+	ctr_internal_object_delete_property(myself, deleteKey, 0);
 	return myself;
 }
 
@@ -866,7 +1136,7 @@ ctr_object* ctr_map_keys(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_mapitem* m;
 	ctr_argument* element;
 	list = ctr_array_new( CtrStdArray, argumentList );
-	m = myself->properties->head;
+	m = myself->properties ? myself->properties->head : NULL;
 	element = ctr_heap_allocate( sizeof( ctr_argument ) );
 	while( m ) {
 		element->object = m->key;
@@ -891,7 +1161,7 @@ ctr_object* ctr_map_values(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_mapitem* m;
 	ctr_argument* element;
 	list = ctr_array_new( CtrStdArray, argumentList );
-	m = myself->properties->head;
+	m = myself->properties ? myself->properties->head : NULL;
 	element = ctr_heap_allocate( sizeof( ctr_argument ) );
 	while( m ) {
 		element->object = m->value;
@@ -915,29 +1185,21 @@ ctr_object* ctr_map_values(ctr_object* myself, ctr_argument* argumentList) {
  * ✎ write: (x ? ‘b’), stop.
  */
 ctr_object* ctr_map_get(ctr_object* myself, ctr_argument* argumentList) {
-
-	ctr_argument* emptyArgumentList;
-	ctr_object*   searchKey;
-	ctr_object*   foundObject;
-
-	emptyArgumentList = ctr_heap_allocate(sizeof(ctr_argument));
-	emptyArgumentList->next = NULL;
-	emptyArgumentList->object = NULL;
-
-	searchKey = argumentList->object;
-
-	/* Give developer a chance to define a key for array */
-	searchKey = ctr_send_message(searchKey, CTR_DICT_TOSTRING, strlen(CTR_DICT_TOSTRING), emptyArgumentList);
-	ctr_heap_free( emptyArgumentList );
-
-	/* If developer returns something other than string (ouch, toString), then cast anyway */
-	if (searchKey->info.type != CTR_OBJECT_TYPE_OTSTRING) {
-		searchKey = ctr_internal_cast2string(searchKey);
+	char buffer[CTR_NUMBER_FORMAT_SIZE];
+	char* key;
+	ctr_size keyLen;
+	ctr_object* searchKey = argumentList->object;
+	ctr_mapitem* item;
+	key = ctr_map_key_bytes(searchKey, buffer, &keyLen);
+	if (key == NULL) {
+		/* Give developer a chance to define a key for array */
+		searchKey = ctr_map_key(searchKey);
+		key = searchKey->value.svalue->value;
+		keyLen = searchKey->value.svalue->vlen;
 	}
-
-	foundObject = ctr_internal_object_find_property(myself, searchKey, 0);
-	if (foundObject == NULL) foundObject = ctr_build_nil();
-	return foundObject;
+	item = ctr_internal_map_find_key(myself->properties, key, keyLen, siphash24(key, keyLen, CtrHashKey));
+	if (item == NULL) return ctr_build_nil();
+	return item->value;
 }
 
 
@@ -953,23 +1215,28 @@ ctr_object* ctr_map_get(ctr_object* myself, ctr_argument* argumentList) {
  * ✎ write: x count, stop.
  */
 ctr_object* ctr_map_count(ctr_object* myself, ctr_argument* argumentList) {
-	return ctr_build_number_from_float( myself->properties->size );
+	return ctr_build_number_from_float( myself->properties ? myself->properties->size : 0 );
 }
 
+/**
+ * @def
+ * [ Map ] copy
+ *
+ * @example
+ * ☞ x ≔ Map new.
+ * x put: 1 at: ‘a’.
+ * ☞ y ≔ x copy.
+ * y put: 2 at: ‘b’.
+ * ✎ write: x count, stop.
+ * ✎ write: y count, stop.
+ */
 ctr_object* ctr_map_copy(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* copy = ctr_map_new(CtrStdMap, argumentList);
 	ctr_mapitem* m;
-	m = myself->properties->head;
+	m = myself->properties ? myself->properties->tail : NULL;
 	while(m) {
-		ctr_argument* arguments = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
-		ctr_argument* argument2 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
-		arguments->object = m->value;
-		argument2->object = m->key;
-		arguments->next = argument2;
-		ctr_map_put(copy, arguments);
-		m = m->next;
-		ctr_heap_free( arguments );
-		ctr_heap_free( argument2 );
+		ctr_internal_object_add_property(copy, m->key, m->value, 0);
+		m = m->prev;
 	}
 	return copy;
 }
@@ -978,6 +1245,10 @@ ctr_object* ctr_map_copy(ctr_object* myself, ctr_argument* argumentList) {
  * @def
  * [ Map ] each: [ Block ]
  *
+ * Runs the block for every entry, oldest first. The entries are
+ * visited in place, adding or removing entries from within the block
+ * raises an error, iterate over a copy to change the map itself.
+ *
  * @example
  * (Map new I: 1, II: 2, III: 3) each: { :a :b
  *   ✎ write: a + b, stop.
@@ -985,36 +1256,49 @@ ctr_object* ctr_map_copy(ctr_object* myself, ctr_argument* argumentList) {
  */
 ctr_object* ctr_map_each(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* block = argumentList->object;
+	ctr_map* map = myself->properties;
 	ctr_mapitem* m;
+	ctr_size modifications;
+	ctr_size roots = ctr_gc_internal_roots();
+	ctr_argument* arguments;
+	ctr_argument* argument2;
+	ctr_argument* argument3;
 	if (block->info.type != CTR_OBJECT_TYPE_OTBLOCK) {
 		CtrStdFlow = ctr_error( CTR_ERR_EXP_BLK, 0 );
+		return myself;
 	}
-	ctr_object* copy = ctr_map_copy(myself, argumentList);
+	if (map == NULL) return myself;
+	arguments = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+	argument2 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+	argument3 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+	arguments->next = argument2;
+	argument2->next = argument3;
+	argument3->object = myself;
+	/* keep receiver in block object otherwise, GC will destroy it */
+	ctr_gc_internal_pin(block);
+	ctr_gc_internal_pin(myself);
 	block->info.sticky = 1;
-	m = copy->properties->head;
+	modifications = map->modifications;
+	map->iterations++;
+	m = map->tail;
 	while(m && !CtrStdFlow) {
-		ctr_argument* arguments = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
-		ctr_argument* argument2 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
-		ctr_argument* argument3 = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
 		arguments->object = m->key;
 		argument2->object = m->value;
-		argument3->object = copy;
-		/* keep receiver in block object otherwise, GC will destroy it */
-		ctr_gc_internal_pin(block);
-		ctr_gc_internal_pin(copy);
-		ctr_gc_internal_pin(argument2->object);
-		ctr_gc_internal_pin(argument3->object);
-		arguments->next = argument2;
-		argument2->next = argument3;
 		ctr_block_run(block, arguments, NULL);
 		if (CtrStdFlow == CtrStdContinue) CtrStdFlow = NULL;
-		m = m->next;
-		ctr_heap_free( arguments );
-		ctr_heap_free( argument2 );
-		ctr_heap_free( argument3 );
+		if (CtrStdFlow) break;
+		if (map->modifications != modifications) {
+			CtrStdFlow = ctr_error( CTR_ERR_MAPMOD, 0 );
+			break;
+		}
+		m = m->prev;
 	}
+	map->iterations--;
+	ctr_gc_internal_unpin(roots);
+	ctr_heap_free( arguments );
+	ctr_heap_free( argument2 );
+	ctr_heap_free( argument3 );
 	if (CtrStdFlow == CtrStdBreak) CtrStdFlow = NULL;
-	block->info.mark = 0;
 	block->info.sticky = 0;
 	return myself;
 }
@@ -1035,7 +1319,7 @@ ctr_object* ctr_map_has(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_mapitem* m;
 	ctr_object* candidate;
 	ctr_object* needle = ctr_internal_cast2string(argumentList->object);
-	m = myself->properties->head;
+	m = myself->properties ? myself->properties->head : NULL;
 	while(m) {
 		candidate = ctr_internal_cast2string(m->value);
 		if ( needle->value.svalue->vlen == candidate->value.svalue->vlen ) {
@@ -1071,7 +1355,7 @@ ctr_object* ctr_map_to_string( ctr_object* myself, ctr_argument* argumentList) {
 		return ctr_build_empty_string();
 	}
 	string  = ctr_build_string_from_cstring( CTR_DICT_CODEGEN_MAP_NEW );
-	mapItem = myself->properties->head;
+	mapItem = myself->properties ? myself->properties->head : NULL;
 	newArgumentList = ctr_heap_allocate( sizeof( ctr_argument ) );
 	while( mapItem ) {
 		newArgumentList->object = ctr_build_string_from_cstring( CTR_DICT_CODEGEN_MAP_PUT );
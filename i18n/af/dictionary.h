@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Nee"
 #define CTR_DICT_NUMBER           "Aantal"
 #define CTR_DICT_STRING           "Teks"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK             "Taak"
 #define CTR_DICT_OBJECT           "Objek"
 #define CTR_DICT_ARRAY_OBJECT      "Reeks"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ja-of-nee"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "tussen:en:"
 #define CTR_DICT_LENGTH	          "lengte"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "vanaf:lengte:"
 #define CTR_DICT_TRIM	          "verwyder-omliggende-ruimtes"
 #define CTR_DICT_AT               "by:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "verbind-met:"
 #define CTR_DICT_POP              "neem-die-laaste"
 #define CTR_DICT_SORT             "sorteer:"
+#define CTR_DICT_SORT_NATURAL    "sorteer"
+#define CTR_DICT_SORT_BY         "sorteer-volgens:"
 #define CTR_DICT_PUT_AT           "sit:by:"
 #define CTR_DICT_MAP              "lys:"
 #define CTR_DICT_EACH             "elk:"
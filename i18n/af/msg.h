@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Moet terugkeer [Boole].\n"
 #define CTR_ERR_NESTING    "Te veel geneste oproepe"
 #define CTR_ERR_KNF        "Sleutel nie gevind nie:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kan nie aan ’n ongedefinieerde veranderlike toewys nie:"
 #define CTR_ERR_EXEC       "Kan nie die opdrag uitvoer nie"
 #define CTR_MSG_DSC_FILE  "file"
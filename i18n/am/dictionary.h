@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "አይ"
 #define CTR_DICT_NUMBER           "ቁጥር"
 #define CTR_DICT_STRING           "ጽሑፍ"
+#define CTR_DICT_BUFFER          "ቋት"
 #define CTR_DICT_TASK       "ስራ"
 #define CTR_DICT_OBJECT           "ነገር"
 #define CTR_DICT_ARRAY_OBJECT      "ተከታታይ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ውሳኔ"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "በመካከል:መጨረሻ:"
 #define CTR_DICT_LENGTH	          "ርዝመት"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ቦታ:ርዝመት:"
 #define CTR_DICT_TRIM	          "ኮር"
 #define CTR_DICT_AT               "ቦታ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ሙጫ:"
 #define CTR_DICT_POP              "ካፕ"
 #define CTR_DICT_SORT             "ደርድር:"
+#define CTR_DICT_SORT_NATURAL    "ደርድር"
+#define CTR_DICT_SORT_BY         "ደርድር-በ:"
 #define CTR_DICT_PUT_AT           "ነገር:ቦታ:"
 #define CTR_DICT_MAP              "ጥንዶች:"
 #define CTR_DICT_EACH             "እያንዳንዳቸው:"
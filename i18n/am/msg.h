@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "መመለስ አለበት [ቡሊያን].\n"
 #define CTR_ERR_NESTING    "በጣም ብዙ የነባር ጥሪዎች።"
 #define CTR_ERR_KNF        "ቁልፉ አልተገኘም"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ላልተገለጸ ተለዋዋጭ መመደብ አይቻልም"
 #define CTR_ERR_EXEC       "ትዕዛዙን መፈጸም አልተቻለም።"
 #define CTR_MSG_DSC_FILE  "file"
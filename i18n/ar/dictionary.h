@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "لا"
 #define CTR_DICT_NUMBER           "رقم"
 #define CTR_DICT_STRING          "نص"
+#define CTR_DICT_BUFFER          "مخزن-مؤقت"
 #define CTR_DICT_TASK       "الشفرة"
 #define CTR_DICT_OBJECT           "موضوع"
 #define CTR_DICT_ARRAY_OBJECT      "قائمة"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "نعم-أو-لا" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN "رقم-عشوائي-بين:و:"
 #define CTR_DICT_LENGTH	          "الطول"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "من:الطول:"
 #define CTR_DICT_TRIM	          "إزالة-المساحات-المحيطة"
 #define CTR_DICT_AT               "في:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "انضم:"
 #define CTR_DICT_POP              "خذ-العنصر-الأخير"
 #define CTR_DICT_SORT             "فرز:"
+#define CTR_DICT_SORT_NATURAL    "فرز"
+#define CTR_DICT_SORT_BY         "فرز-حسب:"
 #define CTR_DICT_PUT_AT           "ضع:في:"
 #define CTR_DICT_MAP              "خريطة:"
 #define CTR_DICT_EACH             "كل:"
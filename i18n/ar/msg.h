@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "يجب العودة [منطقي].\n"
 #define CTR_ERR_NESTING    "مكالمات متداخلة كثيرة جدًا"
 #define CTR_ERR_KNF        "المفتاح غير موجود:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "لا يمكن التعيين لمتغير غير محدد:"
 #define CTR_ERR_EXEC       "غير قادر على تنفيذ الأمر"
 #define CTR_MSG_DSC_FILE  "file"
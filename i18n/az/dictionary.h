@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Yalan"
 #define CTR_DICT_NUMBER           "Nömrə"
 #define CTR_DICT_STRING           "Mətn"
+#define CTR_DICT_BUFFER          "Bufer"
 #define CTR_DICT_TASK       "Tapşırıq"
 #define CTR_DICT_OBJECT           "Obyekt"
 #define CTR_DICT_ARRAY_OBJECT      "Seriya"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "arasında:və:"
 #define CTR_DICT_LENGTH	          "uzunluğu"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "dən:uzunluq:"
 #define CTR_DICT_TRIM	          "ətrafdakı-boşluqları-çıxarın"
 #define CTR_DICT_AT               "at:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "qoşulmaq:"
 #define CTR_DICT_POP              "son-obyekt-tut"
 #define CTR_DICT_SORT             "növ:"
+#define CTR_DICT_SORT_NATURAL    "növ"
+#define CTR_DICT_SORT_BY         "növ-görə:"
 #define CTR_DICT_PUT_AT           "obyekt:yer:"
 #define CTR_DICT_MAP              "siyahı:"
 #define CTR_DICT_EACH             "hər-biri:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Qayıtmalıdır [Boolean].\n"
 #define CTR_ERR_NESTING    "Daxil edilmiş zənglər çoxdur"
 #define CTR_ERR_KNF        "Açar tapılmadı:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Müəyyən olunmayan dəyişənə təyin etmək olmur:"
 #define CTR_ERR_EXEC       "Əmr yerinə yetirmək olmur"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ілжывая"
 #define CTR_DICT_NUMBER           "Нумар"
 #define CTR_DICT_STRING           "Радок"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "Кодэкс"
 #define CTR_DICT_OBJECT           "Аб’ект"
 #define CTR_DICT_ARRAY_OBJECT      "Спіс"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "булева"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "паміж:і:"
 #define CTR_DICT_LENGTH	          "даўжыня"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ад:даўжыня:"
 #define CTR_DICT_TRIM	          "выдаліце ​​навакольныя прасторы"
 #define CTR_DICT_AT               "па адрасе:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "далучайцеся:"
 #define CTR_DICT_POP              "поп"
 #define CTR_DICT_SORT             "Сартаваць:"
+#define CTR_DICT_SORT_NATURAL    "Сартаваць"
+#define CTR_DICT_SORT_BY         "Сартаваць-па:"
 #define CTR_DICT_PUT_AT           "пакласці:у:"
 #define CTR_DICT_MAP              "карта:"
 #define CTR_DICT_EACH             "кожны:"
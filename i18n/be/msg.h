@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Павінен вярнуцца [Булева].\n"
 #define CTR_ERR_NESTING    "Занадта шмат укладзеных званкоў"
 #define CTR_ERR_KNF        "Ключ не знойдзены:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Немагчыма прызначыць нявызначанай зменнай:"
 #define CTR_ERR_EXEC       "Немагчыма выканаць каманду"
 #define CTR_MSG_DSC_FILE  "file"
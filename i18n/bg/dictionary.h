@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "фалшив"
 #define CTR_DICT_NUMBER           "Номер"
 #define CTR_DICT_STRING           "Текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "Задача"
 #define CTR_DICT_OBJECT           "обект"
 #define CTR_DICT_ARRAY_OBJECT      "списък"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "логически"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "между:и:"
 #define CTR_DICT_LENGTH	          "дължина"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "от:дължина:"
 #define CTR_DICT_TRIM	          "отстраняване-на-околните-пространства"
 #define CTR_DICT_AT               "на-адрес:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "присъединяване:"
 #define CTR_DICT_POP              "вземете-последния"
 #define CTR_DICT_SORT             "вид:"
+#define CTR_DICT_SORT_NATURAL    "вид"
+#define CTR_DICT_SORT_BY         "вид-по:"
 #define CTR_DICT_PUT_AT           "слагам:на-адрес:"
 #define CTR_DICT_MAP              "карта:"
 #define CTR_DICT_EACH             "всеки:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Трябва да се върне [Булева].\n"
 #define CTR_ERR_NESTING    "Твърде много вложени обаждания"
 #define CTR_ERR_KNF        "Ключът не е намерен:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Не мога да присвоя на неопределена променлива:"
 #define CTR_ERR_EXEC       "Не може да се изпълни команда"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "মিথ্যা"
 #define CTR_DICT_NUMBER           "সংখ্যা"
 #define CTR_DICT_STRING           "পাঠ্য"
+#define CTR_DICT_BUFFER          "বাফার"
 #define CTR_DICT_TASK       "কোড"
 #define CTR_DICT_OBJECT           "উদ্দেশ্য"
 #define CTR_DICT_ARRAY_OBJECT      "তালিকা"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "_বুলিয়ান"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "মধ্যবর্তী:এবং:"
 #define CTR_DICT_LENGTH	          "লম্বা"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "থেকে:দৈর্ঘ্য:"
 #define CTR_DICT_TRIM	          "পার্শ্ববর্তী-স্পেস-অপসারণ"
 #define CTR_DICT_AT               "হয়:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "যোগ-দিন:"
 #define CTR_DICT_POP              "পপ"
 #define CTR_DICT_SORT             "সাজান:"
+#define CTR_DICT_SORT_NATURAL    "সাজান"
+#define CTR_DICT_SORT_BY         "সাজান-অনুযায়ী:"
 #define CTR_DICT_PUT_AT           "করা:হয়:"
 #define CTR_DICT_MAP              "_মানচিত্র:"
 #define CTR_DICT_EACH             "প্রতিটি:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ফিরে আসতে হবে [বুলিয়ান].\n"
 #define CTR_ERR_NESTING    "অনেক বেশি নেস্টেড কল।"
 #define CTR_ERR_KNF        "কী পাওয়া যায় নি:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "অপরিবর্তিত ভেরিয়েবলকে বরাদ্দ করা যায় না:"
 #define CTR_ERR_EXEC       "কমান্ড কার্যকর করতে অক্ষম।"
 #define CTR_MSG_DSC_FILE  "file"
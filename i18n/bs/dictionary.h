@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Lažno"
 #define CTR_DICT_NUMBER           "Broj"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Bafer"
 #define CTR_DICT_TASK             "Zadatak"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Lista"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "između:i:"
 #define CTR_DICT_LENGTH	          "dužina"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "od:dužina:"
 #define CTR_DICT_TRIM	          "uklonite-okolne-prostore"
 #define CTR_DICT_AT               "sa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pridruži-se:"
 #define CTR_DICT_POP              "uzmi-zadnje"
 #define CTR_DICT_SORT             "sortirati:"
+#define CTR_DICT_SORT_NATURAL    "sortirati"
+#define CTR_DICT_SORT_BY         "sortirati-po:"
 #define CTR_DICT_PUT_AT           "stavi:sa:"
 #define CTR_DICT_MAP              "karta:"
 #define CTR_DICT_EACH             "svaki:"
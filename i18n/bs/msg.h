@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Mora se vratiti [Boolean].\n"
 #define CTR_ERR_NESTING    "Previše ugniježđenih poziva"
 #define CTR_ERR_KNF        "Ključ nije pronađen:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ne mogu se dodijeliti neodređenoj varijabli:"
 #define CTR_ERR_EXEC       "Nije moguće izvršiti naredbu"
 #define CTR_MSG_DSC_FILE  "file"
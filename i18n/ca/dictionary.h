@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Fals"
 #define CTR_DICT_NUMBER           "Número"
 #define CTR_DICT_STRING           "Text"
+#define CTR_DICT_BUFFER          "Memòria-intermèdia"
 #define CTR_DICT_TASK       "Tasca"
 #define CTR_DICT_OBJECT           "Objecte"
 #define CTR_DICT_ARRAY_OBJECT      "Llista"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "booleà"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "entre:i:"
 #define CTR_DICT_LENGTH	          "llargada"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "de:longitud:"
 #define CTR_DICT_TRIM	          "elimina-els-espais-circumdants"
 #define CTR_DICT_AT               "a:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "unir-se:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "ordenar:"
+#define CTR_DICT_SORT_NATURAL    "ordenar"
+#define CTR_DICT_SORT_BY         "ordenar-per:"
 #define CTR_DICT_PUT_AT           "posar:a:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "cadascun:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ha de tornar [Booleà].\n"
 #define CTR_ERR_NESTING    "Massa trucades imbricades"
 #define CTR_ERR_KNF        "Clau no trobada:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "No es pot assignar a una variable no definida:"
 #define CTR_ERR_EXEC       "No es pot executar la comanda"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Bakak"
 #define CTR_DICT_NUMBER           "Numero"
 #define CTR_DICT_STRING           "Ang-String"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Tumong"
 #define CTR_DICT_ARRAY_OBJECT      "Paglista"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "sa-taliwala:ug:"
 #define CTR_DICT_LENGTH	          "gitas-on"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "gikan-sa:gitas-on:"
 #define CTR_DICT_TRIM	          "tangtangon-ang-palibot-nga-mga-wanang"
 #define CTR_DICT_AT               "sa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pag-apil:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "lahi:"
+#define CTR_DICT_SORT_NATURAL    "lahi"
+#define CTR_DICT_SORT_BY         "lahi-pinaagi-sa:"
 #define CTR_DICT_PUT_AT           "gibutang:sa:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "matag-usa:"
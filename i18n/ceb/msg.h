@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kinahanglan mobalik [Boolean].\n"
 #define CTR_ERR_NESTING    "Daghang mga nareal nga tawag"
 #define CTR_ERR_KNF        "Ang yawi dili nakit-an:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Dili ma-assign sa dili natukoy nga variable:"
 #define CTR_ERR_EXEC       "Dili makahimo sa pagtuman sa sugo"
 #define CTR_MSG_DSC_FILE  "file"
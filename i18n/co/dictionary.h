@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "False"
 #define CTR_DICT_NUMBER           "Numero"
 #define CTR_DICT_STRING           "Testua"
+#define CTR_DICT_BUFFER          "Tampone"
 #define CTR_DICT_TASK       "Codice"
 #define CTR_DICT_OBJECT           "Ughjettu"
 #define CTR_DICT_ARRAY_OBJECT      "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "booleanu"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "trà:è:"
 #define CTR_DICT_LENGTH	          "lunghezza"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "da:lunghezza:"
 #define CTR_DICT_TRIM	          "caccià-i-spazii-circundanti"
 #define CTR_DICT_AT               "à:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "unisce:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "sorta:"
+#define CTR_DICT_SORT_NATURAL    "sorta"
+#define CTR_DICT_SORT_BY         "sorta-per:"
 #define CTR_DICT_PUT_AT           "mette:à:"
 #define CTR_DICT_MAP              "lista:"
 #define CTR_DICT_EACH             "ognunu:"
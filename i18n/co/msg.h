@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ci vole à vultà [Booleanu].\n"
 #define CTR_ERR_NESTING    "Troppi chjamati nidificati"
 #define CTR_ERR_KNF        "Chjave micca trovu:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ùn si pò assignà micca à una variabile non definita:"
 #define CTR_ERR_EXEC       "Impussibule di eseguisce u cumandamentu"
 #define CTR_MSG_DSC_FILE  "file"
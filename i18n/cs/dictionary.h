@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Nepravda"
 #define CTR_DICT_NUMBER          "Číslo"
 #define CTR_DICT_STRING          "Řetězec"
+#define CTR_DICT_BUFFER          "Zásobník"
 #define CTR_DICT_TASK      "Kód"
 #define CTR_DICT_OBJECT          "Objekt"
 #define CTR_DICT_ARRAY_OBJECT     "Seznam"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "boolean" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "mezi:a:" 
 #define CTR_DICT_LENGTH	         "délka" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "od:délka:" 
 #define CTR_DICT_TRIM	         "odstranit-okolní-mezery" 
 #define CTR_DICT_AT              "na:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "spojit:" 
 #define CTR_DICT_POP             "vysunout-konec" 
 #define CTR_DICT_SORT            "seřadit:" 
+#define CTR_DICT_SORT_NATURAL    "seřadit"
+#define CTR_DICT_SORT_BY         "seřadit-podle:"
 #define CTR_DICT_PUT_AT          "umístit:na:" 
 #define CTR_DICT_MAP             "všem:" 
 #define CTR_DICT_EACH            "každý:"
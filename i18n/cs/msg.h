@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Musí vracet logickou hodnotu."
 #define CTR_ERR_NESTING   "Příliš mnoho vnořených volání."
 #define CTR_ERR_KNF       "Klíč nebyl nalezen: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Nelze přiřadit nedefinované proměné: "
 #define CTR_ERR_EXEC      "Nelze spustit příkaz."
 #define CTR_MSG_DSC_FILE  "soubor"
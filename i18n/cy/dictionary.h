@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Anghywir"
 #define CTR_DICT_NUMBER           "Rhif"
 #define CTR_DICT_STRING           "Testun"
+#define CTR_DICT_BUFFER          "Byffer"
 #define CTR_DICT_TASK             "Côd"
 #define CTR_DICT_OBJECT           "Gwrthrych"
 #define CTR_DICT_ARRAY_OBJECT      "Rhestr"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "rhwng:a:"
 #define CTR_DICT_LENGTH	          "hyd"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "o:hyd:"
 #define CTR_DICT_TRIM	          "symud-y-lleoedd-cyfagos"
 #define CTR_DICT_AT               "yn:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ymuno:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "didoli:"
+#define CTR_DICT_SORT_NATURAL    "didoli"
+#define CTR_DICT_SORT_BY         "didoli-yn-ôl:"
 #define CTR_DICT_PUT_AT           "rhoi:yn:"
 #define CTR_DICT_MAP              "map:"
 #define CTR_DICT_EACH             "yr-un:"
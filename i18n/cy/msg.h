@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Rhaid dychwelyd [Boole].\n"
 #define CTR_ERR_NESTING    "Gormod o alwadau nythu"
 #define CTR_ERR_KNF        "Ni ddarganfuwyd yr allwedd:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ni ellir aseinio i newidyn heb ei ddiffinio:"
 #define CTR_ERR_EXEC       "Methu gweithredu gorchymyn"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falsk"
 #define CTR_DICT_NUMBER           "Nummer"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK       "Opgave"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Række"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "mellem:og:"
 #define CTR_DICT_LENGTH	          "længde"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "fra:længde:"
 #define CTR_DICT_TRIM	          "fjerne-omgivende-rum"
 #define CTR_DICT_AT               "på:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "tilslutte:"
 #define CTR_DICT_POP              "tag-sidst"
 #define CTR_DICT_SORT             "sortere:"
+#define CTR_DICT_SORT_NATURAL    "sortere"
+#define CTR_DICT_SORT_BY         "sortere-efter:"
 #define CTR_DICT_PUT_AT           "sætte:på:"
 #define CTR_DICT_MAP              "liste:"
 #define CTR_DICT_EACH             "hver:"
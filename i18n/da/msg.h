@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Skal vende tilbage [Boolean].\n"
 #define CTR_ERR_NESTING    "For mange indlejrede opkald"
 #define CTR_ERR_KNF        "Nøgle ikke fundet:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kan ikke tildele en udefineret variabel:"
 #define CTR_ERR_EXEC       "Kan ikke udføre kommando"
 #define CTR_MSG_DSC_FILE  "file"
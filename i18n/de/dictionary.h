@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Nein"
 #define CTR_DICT_NUMBER           "Zahl"
 #define CTR_DICT_STRING           "String"
+#define CTR_DICT_BUFFER          "Puffer"
 #define CTR_DICT_TASK             "Aufgabe"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT     "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ja-oder-nein-"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "zwischen:und:"
 #define CTR_DICT_LENGTH	          "länge"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "von:länge:"
 #define CTR_DICT_TRIM	          "umliegende-räume-entfernen"
 #define CTR_DICT_AT               "beim:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "verschmelzen:"
 #define CTR_DICT_POP              "nimm-letzten"
 #define CTR_DICT_SORT             "sortieren:"
+#define CTR_DICT_SORT_NATURAL    "sortieren"
+#define CTR_DICT_SORT_BY         "sortieren-nach:"
 #define CTR_DICT_PUT_AT           "setzen:auf:"
 #define CTR_DICT_MAP              "liste:"
 #define CTR_DICT_EACH             "jeder:"
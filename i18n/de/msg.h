@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Muss zurückkehren [Boolescher Wert].\n"
 #define CTR_ERR_NESTING    "Zu viele verschachtelte Aufrufe"
 #define CTR_ERR_KNF        "Schlüssel nicht gefunden:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Undefinierte Variable kann nicht zugewiesen werden:"
 #define CTR_ERR_EXEC       "Befehl kann nicht ausgeführt werden"
 #define CTR_MSG_DSC_FILE  "file"
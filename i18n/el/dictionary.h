@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ψευδής"
 #define CTR_DICT_NUMBER           "Αριθμός"
 #define CTR_DICT_STRING           "Kείμενο"
+#define CTR_DICT_BUFFER          "Προσωρινή-μνήμη"
 #define CTR_DICT_TASK       "Κώδικας"
 #define CTR_DICT_OBJECT           "Αντικείμενο"
 #define CTR_DICT_ARRAY_OBJECT      "Σειρά"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ανάμεσα:και:"
 #define CTR_DICT_LENGTH	          "μήκος"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "από:μήκος:"
 #define CTR_DICT_TRIM	          "αφαιρέστε-τους-περιβάλλοντες-χώρους"
 #define CTR_DICT_AT               "στο:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "Συμμετοχή:"
 #define CTR_DICT_POP              "κρότος"
 #define CTR_DICT_SORT             "είδος:"
+#define CTR_DICT_SORT_NATURAL    "είδος"
+#define CTR_DICT_SORT_BY         "είδος-κατά:"
 #define CTR_DICT_PUT_AT           "βάλτε:στη-διεύθυνση:"
 #define CTR_DICT_MAP              "λίστα:"
 #define CTR_DICT_EACH             "καθε:"
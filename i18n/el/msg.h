@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Πρέπει να επιστρέψετε [Boolean].\n"
 #define CTR_ERR_NESTING    "Πάρα πολλές ένθετες κλήσεις"
 #define CTR_ERR_KNF        "Το κλειδί δεν βρέθηκε:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Δεν είναι δυνατή η εκχώρηση σε μη καθορισμένη μεταβλητή:"
 #define CTR_ERR_EXEC       "Δεν είναι δυνατή η εκτέλεση εντολής"
 #define CTR_MSG_DSC_FILE  "file"
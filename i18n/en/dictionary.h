@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "False"
 #define CTR_DICT_NUMBER          "Number"
 #define CTR_DICT_STRING          "String"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK            "Function"
 #define CTR_DICT_OBJECT          "Object"
 #define CTR_DICT_ARRAY_OBJECT    "List"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "bool" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "between:and:" 
 #define CTR_DICT_LENGTH	         "length" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "from:length:" 
 #define CTR_DICT_TRIM	         "trim" 
 #define CTR_DICT_AT              "at:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "combine:" 
 #define CTR_DICT_POP             "pop" 
 #define CTR_DICT_SORT            "sort:" 
+#define CTR_DICT_SORT_NATURAL    "sort"
+#define CTR_DICT_SORT_BY         "sort-by:"
 #define CTR_DICT_PUT_AT          "put:at:" 
 #define CTR_DICT_MAP             "map:" 
 #define CTR_DICT_EACH            "each:"
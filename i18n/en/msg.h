@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Must return a boolean."
 #define CTR_ERR_NESTING   "Too many nested calls."
 #define CTR_ERR_KNF       "Key not found: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Cannot assign to undefined variable: "
 #define CTR_ERR_EXEC      "Unable to execute command."
 #define CTR_MSG_DSC_FILE  "file"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Debe devolver [Booleano].\n"
 #define CTR_ERR_NESTING    "Demasiadas llamadas anidadas"
 #define CTR_ERR_KNF        "Clave no encontrada:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "No se puede asignar a una variable indefinida:"
 #define CTR_ERR_EXEC       "No se puede ejecutar el comando"
 #define CTR_MSG_DSC_FILE  "archivo"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Vale"
 #define CTR_DICT_NUMBER           "Arv"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Puhver"
 #define CTR_DICT_TASK             "Ülesanne"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Seeria"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "loogiline"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "vahel:ja:"
 #define CTR_DICT_LENGTH	          "pikkus"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "alates:pikkus:"
 #define CTR_DICT_TRIM	          "eemaldage-ümbritsevad-ruumid"
 #define CTR_DICT_AT               "aadressil:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "liitu:"
 #define CTR_DICT_POP              "võta-viimane-objekt"
 #define CTR_DICT_SORT             "sorteeri:"
+#define CTR_DICT_SORT_NATURAL    "sorteeri"
+#define CTR_DICT_SORT_BY         "sorteeri-järgi:"
 #define CTR_DICT_PUT_AT           "panna:juures:"
 #define CTR_DICT_MAP              "nimekiri:"
 #define CTR_DICT_EACH             "iga:"
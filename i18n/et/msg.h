@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Tuleb tagasi pöörduda [Boolean].\n"
 #define CTR_ERR_NESTING    "Liiga palju pesastatud kõnesid"
 #define CTR_ERR_KNF        "Võtit ei leitud:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Määratlemata muutujale ei saa määrata:"
 #define CTR_ERR_EXEC       "Käsu ei õnnestunud täita"
 #define CTR_MSG_DSC_FILE  "file"
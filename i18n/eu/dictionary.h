@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Faltsua"
 #define CTR_DICT_NUMBER           "Zenbakia"
 #define CTR_DICT_STRING           "Testua"
+#define CTR_DICT_BUFFER          "Tarteko-memoria"
 #define CTR_DICT_TASK       "Kodea"
 #define CTR_DICT_OBJECT           "Objektu"
 #define CTR_DICT_ARRAY_OBJECT      "Zerrenda"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "erabakia"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "artean:eta:"
 #define CTR_DICT_LENGTH	          "luzera"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "from:luzera:"
 #define CTR_DICT_TRIM	          "kendu-inguruko-espazioak"
 #define CTR_DICT_AT               "at:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "batu:"
 #define CTR_DICT_POP              "hartu-azken"
 #define CTR_DICT_SORT             "ordenatu:"
+#define CTR_DICT_SORT_NATURAL    "ordenatu"
+#define CTR_DICT_SORT_BY         "ordenatu-arabera:"
 #define CTR_DICT_PUT_AT           "jarri:en:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "bakoitzeko:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Itzuli behar da [Boolearrak].\n"
 #define CTR_ERR_NESTING    "Deitutako habia gehiegi"
 #define CTR_ERR_KNF        "Ez da gakoa aurkitu:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ezin da zehaztu zehaztu gabeko aldagaiari:"
 #define CTR_ERR_EXEC       "Ezin da exekutatu komandoa"
 #define CTR_MSG_DSC_FILE  "file"
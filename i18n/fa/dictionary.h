@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "غلط"
 #define CTR_DICT_NUMBER           "عدد"
 #define CTR_DICT_STRING           "متن"
+#define CTR_DICT_BUFFER          "بافر"
 #define CTR_DICT_TASK       "کد"
 #define CTR_DICT_OBJECT           "هدف - شی"
 #define CTR_DICT_ARRAY_OBJECT      "لیست"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "بول"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "عدد تصادفی بین:تا:"
 #define CTR_DICT_LENGTH	          "طول"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "از:طول:"
 #define CTR_DICT_TRIM	          "فضاهای اطراف را حذف کنید"
 #define CTR_DICT_AT               "در:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "پیوستن:"
 #define CTR_DICT_POP              "حذف اخرین عنصر"
 #define CTR_DICT_SORT             "مرتب سازی:"
+#define CTR_DICT_SORT_NATURAL    "مرتب-سازی"
+#define CTR_DICT_SORT_BY         "مرتب-سازی-بر-اساس:"
 #define CTR_DICT_PUT_AT           "قرار دهید:در:"
 #define CTR_DICT_MAP              "نقشه:"
 #define CTR_DICT_EACH             "هر یک:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "باید برگردد [بولی].\n"
 #define CTR_ERR_NESTING    "تماسهای بسیار لانه دار"
 #define CTR_ERR_KNF        "کلید یافت نشد:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "نمی توان به متغیر تعریف نشده اختصاص داد:"
 #define CTR_ERR_EXEC       "اجرای دستور ممکن نیست"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Väärä"
 #define CTR_DICT_NUMBER           "Määrä"
 #define CTR_DICT_STRING           "Teksti"
+#define CTR_DICT_BUFFER          "Puskuri"
 #define CTR_DICT_TASK       "Koodi"
 #define CTR_DICT_OBJECT           "Esine"
 #define CTR_DICT_ARRAY_OBJECT      "Lista"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "välillä:ja:"
 #define CTR_DICT_LENGTH	          "pituus"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "alkaen:pituus:"
 #define CTR_DICT_TRIM	          "poistaa-ympäröivistä-tiloista"
 #define CTR_DICT_AT               "osoitteessa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "liittyä-seuraan:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "järjestellä:"
+#define CTR_DICT_SORT_NATURAL    "järjestellä"
+#define CTR_DICT_SORT_BY         "järjestellä-mukaan:"
 #define CTR_DICT_PUT_AT           "laita:osoitteessa:"
 #define CTR_DICT_MAP              "kartta:"
 #define CTR_DICT_EACH             "kukin:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Täytyy palata [Boolean].\n"
 #define CTR_ERR_NESTING    "Liian monta sisäkkäistä puhelua"
 #define CTR_ERR_KNF        "Avainta ei löytynyt:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ei voida määrittää määrittelemättömälle muuttujalle:"
 #define CTR_ERR_EXEC       "Komentoa ei voida suorittaa"
 #define CTR_MSG_DSC_FILE  "file"
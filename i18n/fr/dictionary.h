@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Non"
 #define CTR_DICT_NUMBER           "Nombre"
 #define CTR_DICT_STRING           "Texte"
+#define CTR_DICT_BUFFER          "Tampon"
 #define CTR_DICT_TASK             "Tâche"
 #define CTR_DICT_OBJECT           "Objet"
 #define CTR_DICT_ARRAY_OBJECT      "Série"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "oui-ou-non"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "entre:et:"
 #define CTR_DICT_LENGTH	          "longueur"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "de:longueur:"
 #define CTR_DICT_TRIM	          "supprimer-les-espaces-environnants"
 #define CTR_DICT_AT               "à:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "fusionner:"
 #define CTR_DICT_POP              "prends-le-dernier"
 #define CTR_DICT_SORT             "trier:"
+#define CTR_DICT_SORT_NATURAL    "trier"
+#define CTR_DICT_SORT_BY         "trier-par:"
 #define CTR_DICT_PUT_AT           "mettre:à:"
 #define CTR_DICT_MAP              "Liste:"
 #define CTR_DICT_EACH             "chaque:"
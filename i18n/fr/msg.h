@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Doit revenir [Booléen].\n"
 #define CTR_ERR_NESTING    "Trop d’appels imbriqués"
 #define CTR_ERR_KNF        "Clé introuvable:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Impossible d’affecter à une variable non définie:"
 #define CTR_ERR_EXEC       "Impossible d’exécuter la commande"
 #define CTR_MSG_DSC_FILE  "file"
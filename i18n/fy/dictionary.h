@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Nee"
 #define CTR_DICT_NUMBER          "Nûmer"
 #define CTR_DICT_STRING          "Tekst"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK            "Taak"
 #define CTR_DICT_OBJECT          "Objekt"
 #define CTR_DICT_ARRAY_OBJECT    "Searje"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "beslissing"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "tusken:en:"
 #define CTR_DICT_LENGTH	          "lingte"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "fan:lingte:"
 #define CTR_DICT_TRIM	          "fuortsmite-omlizzende-romten"
 #define CTR_DICT_AT               "by:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "gearfoegje:"
 #define CTR_DICT_POP              "nim-lêste"
 #define CTR_DICT_SORT             "sortearje:"
+#define CTR_DICT_SORT_NATURAL    "sortearje"
+#define CTR_DICT_SORT_BY         "sortearje-neffens:"
 #define CTR_DICT_PUT_AT           "set:by:"
 #define CTR_DICT_MAP              "map:"
 #define CTR_DICT_EACH             "elk:"
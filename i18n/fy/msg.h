@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Moat weromkomme [Beslissing].\n"
 #define CTR_ERR_NESTING    "Tefolle nestele petearen"
 #define CTR_ERR_KNF        "Kaai net fûn:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kin net tawize oan undefined fariabele:"
 #define CTR_ERR_EXEC       "Kin it kommando net útfiere"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Bréagach"
 #define CTR_DICT_NUMBER           "Uimhir"
 #define CTR_DICT_STRING           "Teaghrán"
+#define CTR_DICT_BUFFER          "Maolán"
 #define CTR_DICT_TASK       "Cód"
 #define CTR_DICT_OBJECT           "Réad"
 #define CTR_DICT_ARRAY_OBJECT      "Liosta"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boole"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "idir:agus:"
 #define CTR_DICT_LENGTH	          "fad"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "_ó:fad:"
 #define CTR_DICT_TRIM	          "bain-na-spásanna-máguaird"
 #define CTR_DICT_AT               "ag:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "páirt-a-ghlacadh:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "sórtáil:"
+#define CTR_DICT_SORT_NATURAL    "sórtáil"
+#define CTR_DICT_SORT_BY         "sórtáil-de-réir:"
 #define CTR_DICT_PUT_AT           "put:at:"
 #define CTR_DICT_MAP              "léarscáil:"
 #define CTR_DICT_EACH             "gach-ceann:"
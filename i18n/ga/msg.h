@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ní mór filleadh [Boole].\n"
 #define CTR_ERR_NESTING    "An iomarca glaonna neadaithe"
 #define CTR_ERR_KNF        "Níor aimsíodh eochair:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ní féidir sannadh d’athróg neamhshainithe:"
 #define CTR_ERR_EXEC       "Ní féidir ordú a fhorghníomhú"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Meallta"
 #define CTR_DICT_NUMBER           "Àireamh"
 #define CTR_DICT_STRING           "Teacs"
+#define CTR_DICT_BUFFER          "Bufair"
 #define CTR_DICT_TASK       "Còd"
 #define CTR_DICT_OBJECT           "Rud"
 #define CTR_DICT_ARRAY_OBJECT      "Liosta"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "eadar:agus:"
 #define CTR_DICT_LENGTH	          "faid"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "bho:faid:"
 #define CTR_DICT_TRIM	          "thoir-air-falbh-àiteachan-mun-cuairt"
 #define CTR_DICT_AT               "aig:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "gabh-a-steach:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "òrdugh:"
+#define CTR_DICT_SORT_NATURAL    "òrdugh"
+#define CTR_DICT_SORT_BY         "òrdugh-a-rèir:"
 #define CTR_DICT_PUT_AT           "cuir:le:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "gach:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Feumar tilleadh [Boole].\n"
 #define CTR_ERR_NESTING    "Cus ghlaodh neadachaidh"
 #define CTR_ERR_KNF        "Cha deach an iuchair a lorg:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Cha ghabh a shònrachadh airson caochladair neo-mhìnichte:"
 #define CTR_ERR_EXEC       "Cha ghabh an àithne a chuir an gnìomh"
 #define CTR_MSG_DSC_FILE  "file"
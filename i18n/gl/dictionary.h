@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falso"
 #define CTR_DICT_NUMBER           "Número"
 #define CTR_DICT_STRING           "Texto"
+#define CTR_DICT_BUFFER          "Búfer"
 #define CTR_DICT_TASK       "Código"
 #define CTR_DICT_OBJECT           "Obxecto"
 #define CTR_DICT_ARRAY_OBJECT      "Lista"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "booleano"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "entre:e:"
 #define CTR_DICT_LENGTH	          "de-lonxitude"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "de:lonxitude:"
 #define CTR_DICT_TRIM	          "elimina-espazos-circundantes"
 #define CTR_DICT_AT               "en:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "unirse:"
 #define CTR_DICT_POP              "toma-o-último"
 #define CTR_DICT_SORT             "ordenar:"
+#define CTR_DICT_SORT_NATURAL    "ordenar"
+#define CTR_DICT_SORT_BY         "ordenar-por:"
 #define CTR_DICT_PUT_AT           "poñer:en:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "cada-un:"
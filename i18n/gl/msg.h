@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Debe volver [Booleano].\n"
 #define CTR_ERR_NESTING    "Demasiadas chamadas anidadas"
 #define CTR_ERR_KNF        "Non se atopou a clave:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Non se pode asignar a unha variable non definida:"
 #define CTR_ERR_EXEC       "Non se puido executar o comando"
 #define CTR_MSG_DSC_FILE  "file"
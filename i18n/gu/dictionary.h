@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ના"
 #define CTR_DICT_NUMBER           "નંબર"
 #define CTR_DICT_STRING           "ટેક્સ્ટ"
+#define CTR_DICT_BUFFER          "બફર"
 #define CTR_DICT_TASK       "કોડ"
 #define CTR_DICT_OBJECT           "Jectબ્જેક્ટ"
 #define CTR_DICT_ARRAY_OBJECT      "કતાર"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "નિર્ણય"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "વચ્ચે:અને:"
 #define CTR_DICT_LENGTH	          "લંબાઈ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "થી:લંબાઈ:"
 #define CTR_DICT_TRIM	          "આસપાસની-જગ્યાઓ-દૂર-કરો"
 #define CTR_DICT_AT               "પર:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "જોડાઓ:"
 #define CTR_DICT_POP              "છેલ્લો-પદાર્થ-પકડો"
 #define CTR_DICT_SORT             "સ-sortર્ટ-કરો:"
+#define CTR_DICT_SORT_NATURAL    "સ-sortર્ટ-કરો"
+#define CTR_DICT_SORT_BY         "સ-sortર્ટ-કરો-મુજબ:"
 #define CTR_DICT_PUT_AT           "મૂકો:પર:"
 #define CTR_DICT_MAP              "યાદી-બનાવ:"
 #define CTR_DICT_EACH             "દરેક:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "પાછા ફરવું પડશે [બુલિયન].\n"
 #define CTR_ERR_NESTING    "ઘણા બધા નેસ્ટેડ ક callsલ્સ"
 #define CTR_ERR_KNF        "કી મળી નથી:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "અપૂર્ણ વ્યાખ્યાયિત ચલને સોંપી શકાતું નથી:"
 #define CTR_ERR_EXEC       "આદેશ ચલાવવામાં અસમર્થ"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Karya"
 #define CTR_DICT_NUMBER           "Lambar"
 #define CTR_DICT_STRING           "Rubutu"
+#define CTR_DICT_BUFFER          "Bafa"
 #define CTR_DICT_TASK       "Aiki"
 #define CTR_DICT_OBJECT           "Nasihu"
 #define CTR_DICT_ARRAY_OBJECT      "Jerin"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "tsakanin:da:"
 #define CTR_DICT_LENGTH	          "tsawon"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "daga:tsayi:"
 #define CTR_DICT_TRIM	          "cire-wuraren-da-ke-kewaye-da-su"
 #define CTR_DICT_AT               "a:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "shiga:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "raba:"
+#define CTR_DICT_SORT_NATURAL    "raba"
+#define CTR_DICT_SORT_BY         "raba-bisa:"
 #define CTR_DICT_PUT_AT           "sanya:a:"
 #define CTR_DICT_MAP              "taswira:"
 #define CTR_DICT_EACH             "kowane:"
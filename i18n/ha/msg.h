@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Dole ne ya dawo [Boolean].\n"
 #define CTR_ERR_NESTING    "Kiran da yawa ya yi kyau"
 #define CTR_ERR_KNF        "Ba a samo mabuɗi ba:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ba za a iya sanya wa mara iyaka mara iyaka ba:"
 #define CTR_ERR_EXEC       "An kasa aiwatar da umarni"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Hoʻolaha"
 #define CTR_DICT_NUMBER           "Helu"
 #define CTR_DICT_STRING           "Kikokikona"
+#define CTR_DICT_BUFFER          "Pale"
 #define CTR_DICT_TASK       "Pāʻālua"
 #define CTR_DICT_OBJECT           "Kākau"
 #define CTR_DICT_ARRAY_OBJECT      "Moʻo"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "mawaena:a:"
 #define CTR_DICT_LENGTH	          "ka-lōʻihi"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "mai:lōʻihi:"
 #define CTR_DICT_TRIM	          "e-kāʻili-i-nā-wahi-i-puni"
 #define CTR_DICT_AT               "i:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "hui-pū-aku:"
 #define CTR_DICT_POP              "popū"
 #define CTR_DICT_SORT             "hoʻokaʻae:"
+#define CTR_DICT_SORT_NATURAL    "hoʻokaʻae"
+#define CTR_DICT_SORT_BY         "hoʻokaʻae-ma:"
 #define CTR_DICT_PUT_AT           "waiho:ma:"
 #define CTR_DICT_MAP              "papa-inoa:"
 #define CTR_DICT_EACH             "pākahi:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Pono e hoʻi [Boolean].\n"
 #define CTR_ERR_NESTING    "Nui nā kelepono i kāhea ʻia"
 #define CTR_ERR_KNF        "ʻAʻole ʻike ka kī:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ʻAʻole hiki ke kuhikuhi i ka loli hiki ʻole ke koho ʻia:"
 #define CTR_ERR_EXEC       "ʻAʻole hiki ke hoʻokō i kahi kauoha"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "שקר"
 #define CTR_DICT_NUMBER           "מספר"
 #define CTR_DICT_STRING           "מחרוזת"
+#define CTR_DICT_BUFFER          "חוצץ"
 #define CTR_DICT_TASK       "קוד"
 #define CTR_DICT_OBJECT           "חפץ"
 #define CTR_DICT_ARRAY_OBJECT      "רשימה"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "_בוליאני"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "בין ו:__:"
 #define CTR_DICT_LENGTH	          "אורך"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "מאורך:__:"
 #define CTR_DICT_TRIM	          "הסר חללים מסביב"
 #define CTR_DICT_AT               "_ב:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "הצטרף:"
 #define CTR_DICT_POP              "פופ"
 #define CTR_DICT_SORT             "_סוג:"
+#define CTR_DICT_SORT_NATURAL    "_סוג"
+#define CTR_DICT_SORT_BY         "_סוג-לפי:"
 #define CTR_DICT_PUT_AT           "לשים:_ב:"
 #define CTR_DICT_MAP              "_מפה:"
 #define CTR_DICT_EACH             "כל אחד:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "חייב לחזור [בוליאני].\n"
 #define CTR_ERR_NESTING    "יותר מדי שיחות מקוננות"
 #define CTR_ERR_KNF        "מפתח לא נמצא:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "לא ניתן להקצות למשתנה לא מוגדר:"
 #define CTR_ERR_EXEC       "לא ניתן לבצע את הפקודה"
 #define CTR_MSG_DSC_FILE  "file"
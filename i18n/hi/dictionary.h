@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "असत्य"
 #define CTR_DICT_NUMBER          "संख्या"
 #define CTR_DICT_STRING          "शब्द"
+#define CTR_DICT_BUFFER          "बफ़र"
 #define CTR_DICT_TASK      "सूत्र"
 #define CTR_DICT_OBJECT          "विषय"
 #define CTR_DICT_ARRAY_OBJECT     "सूची"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "द्विपद-के-लिए" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "बीच:और:" 
 #define CTR_DICT_LENGTH	                         "लंबाई" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	   "द्वारा:लंबाई:" 
 #define CTR_DICT_TRIM	                         "आसपास-के-स्थान-को-हटा-दें" 
 #define CTR_DICT_AT              "पर:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "जोड़ना:" 
 #define CTR_DICT_POP             "सहसा" 
 #define CTR_DICT_SORT            "छँटाई:" 
+#define CTR_DICT_SORT_NATURAL    "छँटाई"
+#define CTR_DICT_SORT_BY         "छँटाई-अनुसार:"
 #define CTR_DICT_PUT_AT          "रखना:पर:" 
 #define CTR_DICT_MAP             "नक्शा:" 
 #define CTR_DICT_EACH            "प्रत्येक:"
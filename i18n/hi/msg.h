@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "एक द्विपद वापस करना चाहिए।"
 #define CTR_ERR_NESTING   "बहुत से नेस्टेड कॉल।"
 #define CTR_ERR_KNF       "कुंजी प्राप्त नहीं हुई: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "अपरिभाषित वेरिएबल पर असाइन नहीं किया जा सकता: "
 #define CTR_ERR_EXEC      "कमांड निष्पादित करने में असमर्थ।"
 #define CTR_MSG_DSC_FILE  "फ़ाइल"
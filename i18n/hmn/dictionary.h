@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Tsis-tseeb"
 #define CTR_DICT_NUMBER           "Tooj"
 #define CTR_DICT_STRING           "Ntawv-nyeem"
+#define CTR_DICT_BUFFER          "Qhov-khaws"
 #define CTR_DICT_TASK       "Cai"
 #define CTR_DICT_OBJECT           "Lub-Hom-Phiaj"
 #define CTR_DICT_ARRAY_OBJECT      "Sau"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ntawm:thiab:"
 #define CTR_DICT_LENGTH	          "ntev"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "los-ntawm:ntev:"
 #define CTR_DICT_TRIM	          "tshem-cov-chaw-ib-puag-ncig"
 #define CTR_DICT_AT               "ntawm:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "koom:"
 #define CTR_DICT_POP              "txiav-qhov-kawg"
 #define CTR_DICT_SORT             "tsi-muaj:"
+#define CTR_DICT_SORT_NATURAL    "tsi-muaj"
+#define CTR_DICT_SORT_BY         "tsi-muaj-raws:"
 #define CTR_DICT_PUT_AT           "muab:rau:"
 #define CTR_DICT_MAP              "daim-duab-qhia-chaw:"
 #define CTR_DICT_EACH             "txhua:"
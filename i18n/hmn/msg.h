@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Yuav tsum rov qab los [Tub Npis].\n"
 #define CTR_ERR_NESTING    "Ntau zes hu"
 #define CTR_ERR_KNF        "Tsis pom qhov tseem ceeb:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Tsis tuaj yeem xa mus rau qhov tsis paub tsis meej:"
 #define CTR_ERR_EXEC       "Tsis tuaj yeem ua tiav cov lus txib"
 #define CTR_MSG_DSC_FILE  "file"
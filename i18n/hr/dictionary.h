@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ne"
 #define CTR_DICT_NUMBER           "Broj"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Međuspremnik"
 #define CTR_DICT_TASK       "Kodirati"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Serija"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "između-i:__:"
 #define CTR_DICT_LENGTH	          "dužina"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "od:dužina:"
 #define CTR_DICT_TRIM	          "ukloniti-okolne-prostore"
 #define CTR_DICT_AT               "na:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pridružiti:"
 #define CTR_DICT_POP              "uzmi-najnoviji"
 #define CTR_DICT_SORT             "sortirati:"
+#define CTR_DICT_SORT_NATURAL    "sortirati"
+#define CTR_DICT_SORT_BY         "sortirati-po:"
 #define CTR_DICT_PUT_AT           "staviti:na:"
 #define CTR_DICT_MAP              "popis:"
 #define CTR_DICT_EACH             "svaki:"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Fo"
 #define CTR_DICT_NUMBER           "Nimewo"
 #define CTR_DICT_STRING           "Fisèl"
+#define CTR_DICT_BUFFER          "Tanpon"
 #define CTR_DICT_TASK       "Kòd"
 #define CTR_DICT_OBJECT           "Objè"
 #define CTR_DICT_ARRAY_OBJECT      "Lis"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ant:ak:"
 #define CTR_DICT_LENGTH	          "longè"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "soti-nan:longè:"
 #define CTR_DICT_TRIM	          "retire-espas-ki-antoure-yo"
 #define CTR_DICT_AT               "nan:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "rantre-nan:"
 #define CTR_DICT_POP              "koupe"
 #define CTR_DICT_SORT             "sòt:"
+#define CTR_DICT_SORT_NATURAL    "sòt"
+#define CTR_DICT_SORT_BY         "sòt-pa:"
 #define CTR_DICT_PUT_AT           "mete:nan:"
 #define CTR_DICT_MAP              "kat:"
 #define CTR_DICT_EACH             "chak:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Dwe retounen [Boolean].\n"
 #define CTR_ERR_NESTING    "Twòp apèl enbrike"
 #define CTR_ERR_KNF        "Kle pa jwenn:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Pa ka bay varyab endefini:"
 #define CTR_ERR_EXEC       "Kapab egzekite lòd"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Hamis"
 #define CTR_DICT_NUMBER           "Szám"
 #define CTR_DICT_STRING           "Szöveg"
+#define CTR_DICT_BUFFER          "Puffer"
 #define CTR_DICT_TASK       "Feladat"
 #define CTR_DICT_OBJECT           "Tárgy"
 #define CTR_DICT_ARRAY_OBJECT      "Sorozat"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "logikai"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "között:és:"
 #define CTR_DICT_LENGTH	          "hossz"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "re:hossza:"
 #define CTR_DICT_TRIM	          "eltávolítás-környező-terek"
 #define CTR_DICT_AT               "nál-nél:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "csatlakozik:"
 #define CTR_DICT_POP              "vegye-utoljára"
 #define CTR_DICT_SORT             "fajta:"
+#define CTR_DICT_SORT_NATURAL    "fajta"
+#define CTR_DICT_SORT_BY         "fajta-szerint:"
 #define CTR_DICT_PUT_AT           "magyarán:itt:"
 #define CTR_DICT_MAP              "lista:"
 #define CTR_DICT_EACH             "minden-egyes:"
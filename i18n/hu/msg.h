@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Vissza kell térnie [Logikai].\n"
 #define CTR_ERR_NESTING    "Túl sok beágyazott hívás"
 #define CTR_ERR_KNF        "Kulcs nem található:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nem adható meg meghatározatlan változónak:"
 #define CTR_ERR_EXEC       "Nem sikerült végrehajtani a parancsot"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "սխալ"
 #define CTR_DICT_NUMBER           "Թիվ"
 #define CTR_DICT_STRING           "տեքստ"
+#define CTR_DICT_BUFFER          "Բուֆեր"
 #define CTR_DICT_TASK       "աշխատանք"
 #define CTR_DICT_OBJECT           "Առարկա"
 #define CTR_DICT_ARRAY_OBJECT      "շարքը"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "լուծել?"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "-ից.-ը."
 #define CTR_DICT_LENGTH	          "երկարությունը"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "սկսած.երկարությունից."
 #define CTR_DICT_TRIM	          "հեռացնել-շրջակա-տարածքները"
 #define CTR_DICT_AT               "մասին."
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "միանալ."
 #define CTR_DICT_POP              "Վերցրեք-վերջին-իրը"
 #define CTR_DICT_SORT             "տեսակավորել."
+#define CTR_DICT_SORT_NATURAL    "տեսակավորել"
+#define CTR_DICT_SORT_BY         "տեսակավորել-ըստ:"
 #define CTR_DICT_PUT_AT           "տալ.համար."
 #define CTR_DICT_MAP              "Կազմեք-ցուցակ."
 #define CTR_DICT_EACH             "յուրաքանչյուրը."
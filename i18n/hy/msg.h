@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Պետք է վերադառնա [Բուլյան].\n"
 #define CTR_ERR_NESTING    "Բազմաթիվ բույնի զանգեր:"
 #define CTR_ERR_KNF        "Բանալի չի գտնվել"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Անհնար է նշանակել չորոշված ​​փոփոխականին"
 #define CTR_ERR_EXEC       "Անհնար է կատարել հրամանը:"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Salah"
 #define CTR_DICT_NUMBER           "Jumlah"
 #define CTR_DICT_STRING           "Tali"
+#define CTR_DICT_BUFFER          "Penyangga"
 #define CTR_DICT_TASK       "Kode"
 #define CTR_DICT_OBJECT           "Obyek"
 #define CTR_DICT_ARRAY_OBJECT      "Seri"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "diantara:dan:"
 #define CTR_DICT_LENGTH	          "panjangnya"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "dari:panjang:"
 #define CTR_DICT_TRIM	          "menghapus-ruang-di-sekitarnya"
 #define CTR_DICT_AT               "di:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ikuti:"
 #define CTR_DICT_POP              "ambil-yang-terakhir"
 #define CTR_DICT_SORT             "menyortir:"
+#define CTR_DICT_SORT_NATURAL    "menyortir"
+#define CTR_DICT_SORT_BY         "menyortir-berdasarkan:"
 #define CTR_DICT_PUT_AT           "menempatkan:di:"
 #define CTR_DICT_MAP              "daftar:"
 #define CTR_DICT_EACH             "setiap:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Harus kembali [Boolean].\n"
 #define CTR_ERR_NESTING    "Terlalu banyak panggilan bersarang"
 #define CTR_ERR_KNF        "Kunci tidak ditemukan:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Tidak dapat menetapkan ke variabel tidak terdefinisi:"
 #define CTR_ERR_EXEC       "Tidak dapat menjalankan perintah"
 #define CTR_MSG_DSC_FILE  "file"
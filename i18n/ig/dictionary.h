@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Gha"
 #define CTR_DICT_NUMBER           "Nọmba"
 #define CTR_DICT_STRING           "Ederede"
+#define CTR_DICT_BUFFER          "Nchekwa"
 #define CTR_DICT_TASK       "Ọrụ"
 #define CTR_DICT_OBJECT           "Ebumnuche"
 #define CTR_DICT_ARRAY_OBJECT      "Ndepụta"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "n']etiti:na:"
 #define CTR_DICT_LENGTH	          "ogologo"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "site-na:ogologo:"
 #define CTR_DICT_TRIM	          "wepụ-oghere-ndị-gbara-ya-gburugburu"
 #define CTR_DICT_AT               "ebe:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "sonyere:"
 #define CTR_DICT_POP              "gbaputa"
 #define CTR_DICT_SORT             "ụdị:"
+#define CTR_DICT_SORT_NATURAL    "hazie"
+#define CTR_DICT_SORT_BY         "hazie-site-na:"
 #define CTR_DICT_PUT_AT           "tinye:na:"
 #define CTR_DICT_MAP              "maapu:"
 #define CTR_DICT_EACH             "nke-ọ-bụla:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ga-alaghachi [Boolean].\n"
 #define CTR_ERR_NESTING    "Ọtụtụ oku ejila"
 #define CTR_ERR_KNF        "Ahụghị igodo:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Enweghị ike inyefe na agbanweghi agbanweghi:"
 #define CTR_ERR_EXEC       "Enweghi ike ime iwu"
 #define CTR_MSG_DSC_FILE  "file"
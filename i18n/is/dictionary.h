@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Rangt"
 #define CTR_DICT_NUMBER           "Fjöldi"
 #define CTR_DICT_STRING           "Texti"
+#define CTR_DICT_BUFFER          "Biðminni"
 #define CTR_DICT_TASK       "Verkefni"
 #define CTR_DICT_OBJECT           "Markmið"
 #define CTR_DICT_ARRAY_OBJECT      "Röð"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "milli:og:"
 #define CTR_DICT_LENGTH	          "lengd"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "frá:lengd:"
 #define CTR_DICT_TRIM	          "fjarlægja-nærliggjandi-rými"
 #define CTR_DICT_AT               "kl:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "taka-þátt:"
 #define CTR_DICT_POP              "taka-síðasta"
 #define CTR_DICT_SORT             "flokka:"
+#define CTR_DICT_SORT_NATURAL    "flokka"
+#define CTR_DICT_SORT_BY         "flokka-eftir:"
 #define CTR_DICT_PUT_AT           "settu:í:"
 #define CTR_DICT_MAP              "listi:"
 #define CTR_DICT_EACH             "hver:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Verður að snúa aftur [Boolean].\n"
 #define CTR_ERR_NESTING    "Of mörg nestuð símtöl"
 #define CTR_ERR_KNF        "Lykill fannst ekki:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ekki hægt að tengja við óskilgreinda breytu:"
 #define CTR_ERR_EXEC       "Ekki hægt að framkvæma skipun"
 #define CTR_MSG_DSC_FILE  "file"
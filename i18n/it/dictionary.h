@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falso"
 #define CTR_DICT_NUMBER           "Numero"
 #define CTR_DICT_STRING           "Testo"
+#define CTR_DICT_BUFFER          "Tampone"
 #define CTR_DICT_TASK             "Compito"
 #define CTR_DICT_OBJECT           "Oggetto"
 #define CTR_DICT_ARRAY_OBJECT     "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "booleano"
 #define CTR_DICT_RANDOM_NUM_BETWEEN "tra:e:"
 #define CTR_DICT_LENGTH	          "lunghezza"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "da:lunghezza:"
 #define CTR_DICT_TRIM	          "rimuovere-gli-spazi-circostanti"
 #define CTR_DICT_AT               "a:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "aderire:"
 #define CTR_DICT_POP              "prendi-l'ultimo"
 #define CTR_DICT_SORT             "ordinare:"
+#define CTR_DICT_SORT_NATURAL    "ordinare"
+#define CTR_DICT_SORT_BY         "ordinare-per:"
 #define CTR_DICT_PUT_AT           "mettere:a:"
 #define CTR_DICT_MAP              "elenco:"
 #define CTR_DICT_EACH             "ogni:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Deve tornare [Booleano].\n"
 #define CTR_ERR_NESTING    "Troppe chiamate nidificate"
 #define CTR_ERR_KNF        "Chiave non trovata:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Impossibile assegnare a una variabile non definita:"
 #define CTR_ERR_EXEC       "Impossibile eseguire il comando"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "誤り"
 #define CTR_DICT_NUMBER           "_数"
 #define CTR_DICT_STRING           "テキスト"
+#define CTR_DICT_BUFFER          "バッファ"
 #define CTR_DICT_TASK             "タスク"
 #define CTR_DICT_OBJECT           "対象"
 #define CTR_DICT_ARRAY_OBJECT      "シリーズ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "_ブール"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "間:と:"
 #define CTR_DICT_LENGTH	          "長さ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "から:長さ:"
 #define CTR_DICT_TRIM	          "周囲のスペースを削除"
 #define CTR_DICT_AT               "で:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "参加:"
 #define CTR_DICT_POP              "テイク-ザ-ラスト"
 #define CTR_DICT_SORT             "ソート:"
+#define CTR_DICT_SORT_NATURAL    "ソート"
+#define CTR_DICT_SORT_BY         "ソート基準:"
 #define CTR_DICT_PUT_AT           "要素:値:"
 #define CTR_DICT_MAP              "リスト:"
 #define CTR_DICT_EACH             "各:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "戻る必要があります [ブール].\n"
 #define CTR_ERR_NESTING    "ネストされた呼び出しが多すぎます。"
 #define CTR_ERR_KNF        "キーが見つかりません："
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "未定義の変数に割り当てることはできません："
 #define CTR_ERR_EXEC       "コマンドを実行できません。"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ora"
 #define CTR_DICT_NUMBER           "Nomer"
 #define CTR_DICT_STRING           "Tèks"
+#define CTR_DICT_BUFFER          "Penyangga"
 #define CTR_DICT_TASK       "Kode"
 #define CTR_DICT_OBJECT           "Obyek"
 #define CTR_DICT_ARRAY_OBJECT      "Dhaptar"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "antarane:lan:"
 #define CTR_DICT_LENGTH	          "dawa"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "saka:dawa:"
 #define CTR_DICT_TRIM	          "mbusak-spasi-sekitar"
 #define CTR_DICT_AT               "ing:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "gabung:"
 #define CTR_DICT_POP              "njupuk-obyek-pungkasan"
 #define CTR_DICT_SORT             "urut:"
+#define CTR_DICT_SORT_NATURAL    "urut"
+#define CTR_DICT_SORT_BY         "urut-miturut:"
 #define CTR_DICT_PUT_AT           "sijine:ing:"
 #define CTR_DICT_MAP              "peta:"
 #define CTR_DICT_EACH             "masing-masing:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kudu bali [Boolean].\n"
 #define CTR_ERR_NESTING    "Akeh banget telpon"
 #define CTR_ERR_KNF        "Kunci ora ditemokake:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ora bisa nemoni variabel sing ora ditemtokake:"
 #define CTR_ERR_EXEC       "Ora bisa nglakokake printah"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "შეცდომა"
 #define CTR_DICT_NUMBER           "რიცხვი"
 #define CTR_DICT_STRING           "ტექსტი"
+#define CTR_DICT_BUFFER          "ბუფერი"
 #define CTR_DICT_TASK             "ამოცანა"
 #define CTR_DICT_OBJECT           "ობიექტი"
 #define CTR_DICT_ARRAY_OBJECT      "სერია"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ბოულიანი"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "მინიმალური:მაქსიმალური:"
 #define CTR_DICT_LENGTH	          "სიგრძე"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "დასაწყისი:სიგრძე:"
 #define CTR_DICT_TRIM	          "მოიცილეთ-მიმდებარე-სივრცეები"
 #define CTR_DICT_AT               "ობიექტი:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "შეერთება:"
 #define CTR_DICT_POP              "ვიღებ-ბოლო-ობიექტი"
 #define CTR_DICT_SORT             "დალაგება:"
+#define CTR_DICT_SORT_NATURAL    "დალაგება"
+#define CTR_DICT_SORT_BY         "დალაგება-მიხედვით:"
 #define CTR_DICT_PUT_AT           "დააყენა:ადგილი:"
 #define CTR_DICT_MAP              "რუკების:"
 #define CTR_DICT_EACH             "თითოეული:"
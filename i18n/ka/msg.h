@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "უნდა დაბრუნდეს [ბულიონი].\n"
 #define CTR_ERR_NESTING    "ძალიან ბევრი ბუდეები"
 #define CTR_ERR_KNF        "გასაღები ვერ მოიძებნა:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "დაუყოვნებელი ცვლადის გადაცემა შეუძლებელია:"
 #define CTR_ERR_EXEC       "ბრძანების შესრულება შეუძლებელია"
 #define CTR_MSG_DSC_FILE  "file"
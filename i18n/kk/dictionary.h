@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Жалған"
 #define CTR_DICT_NUMBER           "Сан"
 #define CTR_DICT_STRING           "мәтін"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "тапсырма"
 #define CTR_DICT_OBJECT           "Нысан"
 #define CTR_DICT_ARRAY_OBJECT      "Тізім"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "логикалық"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "арасында:және:"
 #define CTR_DICT_LENGTH	          "ұзындығы"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "басталуы:ұзындығы:"
 #define CTR_DICT_TRIM	          "қоршаған-кеңістікті-алып-тастаңыз"
 #define CTR_DICT_AT               "жанында:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "қосылу:"
 #define CTR_DICT_POP              "артқа-алу"
 #define CTR_DICT_SORT             "сұрыптау:"
+#define CTR_DICT_SORT_NATURAL    "сұрыптау"
+#define CTR_DICT_SORT_BY         "сұрыптау-бойынша:"
 #define CTR_DICT_PUT_AT           "hысан:oрын:"
 #define CTR_DICT_MAP              "карта:"
 #define CTR_DICT_EACH             "әрқайсысы:"
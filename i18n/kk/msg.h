@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Қайтып келу керек [Бульдік].\n"
 #define CTR_ERR_NESTING    "Кірістірілген қоңыраулар тым көп"
 #define CTR_ERR_KNF        "Кілт табылмады:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Анықталмаған айнымалыға тағайындау мүмкін емес:"
 #define CTR_ERR_EXEC       "Пәрменді орындау мүмкін емес"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "មិនពិត"
 #define CTR_DICT_NUMBER           "ចំនួន"
 #define CTR_DICT_STRING           "អត្ថបទ"
+#define CTR_DICT_BUFFER          "សតិបណ្ដោះអាសន្ន"
 #define CTR_DICT_TASK       "លេខកូដ"
 #define CTR_DICT_OBJECT           "វត្ថុ"
 #define CTR_DICT_ARRAY_OBJECT      "បញ្ជី"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "សេចក្តីសម្រេច"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "រវាង:និង:"
 #define CTR_DICT_LENGTH	          "ប្រវែង"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ពី:ប្រវែង:"
 #define CTR_DICT_TRIM	          "យកចន្លោះនៅជុំវិញ"
 #define CTR_DICT_AT               "នៅ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ចូលរួម:"
 #define CTR_DICT_POP              "ប៉ុប"
 #define CTR_DICT_SORT             "តម្រៀប:"
+#define CTR_DICT_SORT_NATURAL    "តម្រៀប"
+#define CTR_DICT_SORT_BY         "តម្រៀប-តាម:"
 #define CTR_DICT_PUT_AT           "ដាក់:នៅ:"
 #define CTR_DICT_MAP              "ផែនទី:"
 #define CTR_DICT_EACH             "គ្នា:"
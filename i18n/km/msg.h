@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ត្រូវតែត្រឡប់មកវិញ [ប៊ូលីន].\n"
 #define CTR_ERR_NESTING    "ការហៅទូរស័ព្ទបានភ្ជាប់គ្នាច្រើនពេក។"
 #define CTR_ERR_KNF        "រកមិនឃើញកូនសោ៖"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "មិនអាចកំណត់ទៅអថេរដែលមិនបានកំណត់៖"
 #define CTR_ERR_EXEC       "មិនអាចប្រតិបត្តិពាក្យបញ្ជាបានទេ។"
 #define CTR_MSG_DSC_FILE  "file"
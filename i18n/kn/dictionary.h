@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ತಪ್ಪು"
 #define CTR_DICT_NUMBER           "ಸಂಖ್ಯೆ"
 #define CTR_DICT_STRING           "ಪಠ್ಯ"
+#define CTR_DICT_BUFFER          "ಬಫರ್"
 #define CTR_DICT_TASK       "ಕಾರ್ಯ"
 #define CTR_DICT_OBJECT           "ವಸ್ತು"
 #define CTR_DICT_ARRAY_OBJECT      "ಪಟ್ಟಿ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ನಿರ್ಧಾರ"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ನಡುವೆ:ಮತ್ತು:"
 #define CTR_DICT_LENGTH	          "ಉದ್ದ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ಇಂದ:ಉದ್ದ:"
 #define CTR_DICT_TRIM	          "ಸುತ್ತಮುತ್ತಲಿನ-ಸ್ಥಳಗಳನ್ನು-ತೆಗೆದುಹಾಕಿ"
 #define CTR_DICT_AT               "ಇಲ್ಲಿ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ಸೇರಲು:"
 #define CTR_DICT_POP              "ಪಾಪ್"
 #define CTR_DICT_SORT             "ವಿಂಗಡಿಸಿ:"
+#define CTR_DICT_SORT_NATURAL    "ವಿಂಗಡಿಸಿ"
+#define CTR_DICT_SORT_BY         "ವಿಂಗಡಿಸಿ-ಪ್ರಕಾರ:"
 #define CTR_DICT_PUT_AT           "ಪುಟ್:ನಲ್ಲಿ:"
 #define CTR_DICT_MAP              "ದಂಪತಿಗಳು:"
 #define CTR_DICT_EACH             "ಪ್ರತಿಯೊಂದೂ:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ಹಿಂತಿರುಗಬೇಕು [ಬೂಲಿಯನ್].\n"
 #define CTR_ERR_NESTING    "ಹಲವಾರು ನೆಸ್ಟೆಡ್ ಕರೆಗಳು"
 #define CTR_ERR_KNF        "ಕೀ ಕಂಡುಬಂದಿಲ್ಲ:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ವಿವರಿಸಲಾಗದ ವೇರಿಯೇಬಲ್ಗೆ ನಿಯೋಜಿಸಲು ಸಾಧ್ಯವಿಲ್ಲ:"
 #define CTR_ERR_EXEC       "ಆಜ್ಞೆಯನ್ನು ಕಾರ್ಯಗತಗೊಳಿಸಲು ಸಾಧ್ಯವಿಲ್ಲ"
 #define CTR_MSG_DSC_FILE  "file"
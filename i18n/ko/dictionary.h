@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "아니요"
 #define CTR_DICT_NUMBER           "번호"
 #define CTR_DICT_STRING           "텍스트"
+#define CTR_DICT_BUFFER          "버퍼"
 #define CTR_DICT_TASK       "암호"
 #define CTR_DICT_OBJECT           "목적"
 #define CTR_DICT_ARRAY_OBJECT      "명부"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "결정"
 #define CTR_DICT_RANDOM_NUM_BETWEEN "의 사이에 :그리고:"
 #define CTR_DICT_LENGTH	          "길이"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "부터 :길이 :"
 #define CTR_DICT_TRIM	          "주변 공간 제거"
 #define CTR_DICT_AT               "에서:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "붙다:"
 #define CTR_DICT_POP              "마지막 항목"
 #define CTR_DICT_SORT             "종류:"
+#define CTR_DICT_SORT_NATURAL    "종류"
+#define CTR_DICT_SORT_BY         "종류기준:"
 #define CTR_DICT_PUT_AT           "협회:와:"
 #define CTR_DICT_MAP              "지도:"
 #define CTR_DICT_EACH             "마다:"
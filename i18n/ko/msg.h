@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "돌아와야한다 [부울].\n"
 #define CTR_ERR_NESTING    "중첩 된 통화가 너무 많습니다"
 #define CTR_ERR_KNF        "키를 찾을 수 없습니다 :"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "정의되지 않은 변수를 할당 할 수 없습니다 :"
 #define CTR_ERR_EXEC       "명령을 실행할 수 없습니다"
 #define CTR_MSG_DSC_FILE  "file"
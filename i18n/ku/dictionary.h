@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Na"
 #define CTR_DICT_NUMBER           "Jimare"
 #define CTR_DICT_STRING           "Nivîstok"
+#define CTR_DICT_BUFFER          "Bafir"
 #define CTR_DICT_TASK       "Kar"
 #define CTR_DICT_OBJECT           "Tişt"
 #define CTR_DICT_ARRAY_OBJECT      "Rêzek"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "erê/na"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "di-navbera:û:"
 #define CTR_DICT_LENGTH	          "dirêjî"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ji:dirêjî:"
 #define CTR_DICT_TRIM	          "valahiyên-derdorê-derxînin"
 #define CTR_DICT_AT               "ba:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "bihevgirêdan:"
 #define CTR_DICT_POP              "dawî-bigirin"
 #define CTR_DICT_SORT             "jiberhevxistin:"
+#define CTR_DICT_SORT_NATURAL    "jiberhevxistin"
+#define CTR_DICT_SORT_BY         "jiberhevxistin-li-gorî:"
 #define CTR_DICT_PUT_AT           "danîn:li:"
 #define CTR_DICT_MAP              "lîsteyek:"
 #define CTR_DICT_EACH             "herkes:"
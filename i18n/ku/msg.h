@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Pêdivî ye ku vegere [Boolean].\n"
 #define CTR_ERR_NESTING    "Gelek banga neşopandî"
 #define CTR_ERR_KNF        "Key nehat dîtin:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nabe ku em li guherbara nederbasdar were veqetandin:"
 #define CTR_ERR_EXEC       "Ferman nikare nekeve"
 #define CTR_MSG_DSC_FILE  "file"
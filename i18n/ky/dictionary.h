@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Жок"
 #define CTR_DICT_NUMBER           "Cан"
 #define CTR_DICT_STRING           "Сөз"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "Tапшырма"
 #define CTR_DICT_OBJECT           "зат"
 #define CTR_DICT_ARRAY_OBJECT      "тизме"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "oоба-же-жок"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ортосунда:жана:"
 #define CTR_DICT_LENGTH	          "узундук"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "чейин:узундугу:"
 #define CTR_DICT_TRIM	          "курчап-боштуктарды-алып"
 #define CTR_DICT_AT               "боюнча:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "кошулууга:"
 #define CTR_DICT_POP              "акыркы-объектти-алуу"
 #define CTR_DICT_SORT             "сорттоо:"
+#define CTR_DICT_SORT_NATURAL    "сорттоо"
+#define CTR_DICT_SORT_BY         "сорттоо-боюнча:"
 #define CTR_DICT_PUT_AT           "койду:эле:"
 #define CTR_DICT_MAP              "карта:"
 #define CTR_DICT_EACH             "ар-бири:"
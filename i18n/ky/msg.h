@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "керек кайтып [логикалык].\n"
 #define CTR_ERR_NESTING    "Өтө көп камтылган чалуулар"
 #define CTR_ERR_KNF        "Негизги табылган жок:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "белгисиз өзгөрмөлүү жүктөлсүн мүмкүн эмес:"
 #define CTR_ERR_EXEC       "буйругун аткарууга мүмкүн болбой жатат"
 #define CTR_MSG_DSC_FILE  "file"
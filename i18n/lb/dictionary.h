@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falsch"
 #define CTR_DICT_NUMBER           "Zuel"
 #define CTR_DICT_STRING           "Text"
+#define CTR_DICT_BUFFER          "Puffer"
 #define CTR_DICT_TASK       "Aufgab"
 #define CTR_DICT_OBJECT           "Objet"
 #define CTR_DICT_ARRAY_OBJECT      "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolschen"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "tëscht:an:"
 #define CTR_DICT_LENGTH	          "längt"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "vun:längt:"
 #define CTR_DICT_TRIM	          "ewechzehuelen-Ëmfeld"
 #define CTR_DICT_AT               "bei:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "maach-mat:"
 #define CTR_DICT_POP              "giff-de-leschte"
 #define CTR_DICT_SORT             "zortéieren:"
+#define CTR_DICT_SORT_NATURAL    "zortéieren"
+#define CTR_DICT_SORT_BY         "zortéieren-no:"
 #define CTR_DICT_PUT_AT           "setzen:bei:"
 #define CTR_DICT_MAP              "lëscht:"
 #define CTR_DICT_EACH             "jiddereen:"
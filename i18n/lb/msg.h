@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Misst zréck [Boolschen].\n"
 #define CTR_ERR_NESTING    "Ze vill nestéiert Appellen"
 #define CTR_ERR_KNF        "Schlëssel net fonnt:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kann net op ondefinéiert Variabel zouloossen:"
 #define CTR_ERR_EXEC       "Kann de Kommando net ausféieren"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ບໍ່"
 #define CTR_DICT_NUMBER           "ເລກ"
 #define CTR_DICT_STRING           "ຂໍ້ຄວາມ"
+#define CTR_DICT_BUFFER          "ບັຟເຟີ"
 #define CTR_DICT_TASK       "ເຮັດວຽກ"
 #define CTR_DICT_OBJECT           "ຈຸດປະສົງ"
 #define CTR_DICT_ARRAY_OBJECT      "ຊຸດ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ປຸ້ຍ"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ລະຫວ່າງ:ແລະ:"
 #define CTR_DICT_LENGTH	          "ຄວາມຍາວ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ຈາກ:ຄວາມຍາວ:"
 #define CTR_DICT_TRIM	          "ເອົາສະຖານທີ່ອ້ອມຮອບ"
 #define CTR_DICT_AT               "ທີ່:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ເຂົ້າຮ່ວມ:"
 #define CTR_DICT_POP              "ເອົາສຸດທ້າຍ"
 #define CTR_DICT_SORT             "ຄັດ:"
+#define CTR_DICT_SORT_NATURAL    "ຄັດ"
+#define CTR_DICT_SORT_BY         "ຄັດ-ຕາມ:"
 #define CTR_DICT_PUT_AT           "ໃສ່:ທີ່:"
 #define CTR_DICT_MAP              "ລາຍຊື່:"
 #define CTR_DICT_EACH             "ແຕ່ລະ:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ຕ້ອງກັບຄືນມາ [ບົວບານ].\n"
 #define CTR_ERR_NESTING    "ມີການຮວບຮວມການໂທຫຼາຍເກີນໄປ"
 #define CTR_ERR_KNF        "ບໍ່ພົບຄີ:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ບໍ່ສາມາດ ກຳ ຫນົດໃຫ້ຕົວແປທີ່ບໍ່ໄດ້ ກຳ ນົດ:"
 #define CTR_ERR_EXEC       "ບໍ່ສາມາດປະຕິບັດ ຄຳ ສັ່ງໄດ້"
 #define CTR_MSG_DSC_FILE  "file"
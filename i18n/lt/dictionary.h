@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Netiesa"
 #define CTR_DICT_NUMBER          "Skaičius"
 #define CTR_DICT_STRING          "Tekstą"
+#define CTR_DICT_BUFFER          "Buferis"
 #define CTR_DICT_TASK      "Kodas"
 #define CTR_DICT_OBJECT          "Objektas"
 #define CTR_DICT_ARRAY_OBJECT     "Sąrašas"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "į-loginį"
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "tarp:ir:"
 #define CTR_DICT_LENGTH	         "ilgis"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "nuo:ilgis:"
 #define CTR_DICT_TRIM	         "pašalinti-tarpus-aplink"
 #define CTR_DICT_AT              "_į:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "sujungti:"
 #define CTR_DICT_POP             "išimti"
 #define CTR_DICT_SORT            "rūšiuoti:"
+#define CTR_DICT_SORT_NATURAL    "rūšiuoti"
+#define CTR_DICT_SORT_BY         "rūšiuoti-pagal:"
 #define CTR_DICT_PUT_AT          "įdėti:_į:"
 #define CTR_DICT_MAP             "map:"
 #define CTR_DICT_EACH            "kiekvienas:"
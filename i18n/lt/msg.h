@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Turi grąžinti loginę reikšmę."
 #define CTR_ERR_NESTING   "Per daug įdėtūjų kvietinių."
 #define CTR_ERR_KNF       "Raktas nerastas: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Neįmanoma priskirti reikšmės neapibrėžtam kintamajam: "
 #define CTR_ERR_EXEC      "Neįmanoma įvykdyti komandos."
 #define CTR_MSG_DSC_FILE  "failas"
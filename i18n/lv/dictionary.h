@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Viltus"
 #define CTR_DICT_NUMBER           "Skaits"
 #define CTR_DICT_STRING           "Teksts"
+#define CTR_DICT_BUFFER          "Buferis"
 #define CTR_DICT_TASK       "Uzdevums"
 #define CTR_DICT_OBJECT           "Objekts"
 #define CTR_DICT_ARRAY_OBJECT      "Saraksts"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "būla"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "starp:un:"
 #define CTR_DICT_LENGTH	          "garums"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "no:garums:"
 #define CTR_DICT_TRIM	          "noņemiet-apkārtējās-telpas"
 #define CTR_DICT_AT               "pie:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pievienoties:"
 #define CTR_DICT_POP              "veikt-sufikss"
 #define CTR_DICT_SORT             "kārtot:"
+#define CTR_DICT_SORT_NATURAL    "kārtot"
+#define CTR_DICT_SORT_BY         "kārtot-pēc:"
 #define CTR_DICT_PUT_AT           "ievietot:pie:"
 #define CTR_DICT_MAP              "karte:"
 #define CTR_DICT_EACH             "katrs:"
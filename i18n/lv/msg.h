@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Jāatgriežas [Būla].\n"
 #define CTR_ERR_NESTING    "Pārāk daudz ligzdotu zvanu"
 #define CTR_ERR_KNF        "Atslēga nav atrasta:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nevar piešķirt nedefinētam mainīgajam:"
 #define CTR_ERR_EXEC       "Nevar izpildīt komandu"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Diso"
 #define CTR_DICT_NUMBER           "Number"
 #define CTR_DICT_STRING           "String"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Zavatra"
 #define CTR_DICT_ARRAY_OBJECT      "List"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "eo:ary:"
 #define CTR_DICT_LENGTH	          "halavan']ny"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "from:lavany:"
 #define CTR_DICT_TRIM	          "esory-toerana-manodidina"
 #define CTR_DICT_AT               "amin']ny:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "anjara:"
 #define CTR_DICT_POP              "tsapako"
 #define CTR_DICT_SORT             "sort:"
+#define CTR_DICT_SORT_NATURAL    "sort"
+#define CTR_DICT_SORT_BY         "sort-by:"
 #define CTR_DICT_PUT_AT           "hametraka:amin']ny:"
 #define CTR_DICT_MAP              "sarintany:"
 #define CTR_DICT_EACH             "tsirairay:"
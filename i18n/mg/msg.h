@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Tsy maintsy miverina [Boolean].\n"
 #define CTR_ERR_NESTING    "Antso an-telefaona maro loatra"
 #define CTR_ERR_KNF        "Key tsy hita:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Tsy afaka nanendry amin’ny endrika tsy voafaritra:"
 #define CTR_ERR_EXEC       "Tsy afaka nanatanteraka baiko"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Kahore"
 #define CTR_DICT_NUMBER           "Tau"
 #define CTR_DICT_STRING           "Kuputuhi"
+#define CTR_DICT_BUFFER          "Pafa"
 #define CTR_DICT_TASK       "Mahi"
 #define CTR_DICT_OBJECT           "Ahanoa"
 #define CTR_DICT_ARRAY_OBJECT      "Raupapa"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "whakatau"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "i-waenga-i:me:"
 #define CTR_DICT_LENGTH	          "roa"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "mai:roa:"
 #define CTR_DICT_TRIM	          "tango-i-nga-waahi-taangata"
 #define CTR_DICT_AT               "i:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "uru-atu:"
 #define CTR_DICT_POP              "tiki-i-te-mea-whakamutunga"
 #define CTR_DICT_SORT             "kōmaka:"
+#define CTR_DICT_SORT_NATURAL    "kōmaka"
+#define CTR_DICT_SORT_BY         "kōmaka-mā:"
 #define CTR_DICT_PUT_AT           "ahanoa:wahi:"
 #define CTR_DICT_MAP              "rarangi:"
 #define CTR_DICT_EACH             "ia:"
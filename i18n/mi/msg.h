@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Me hoki te hokinga mai [Poei].\n"
 #define CTR_ERR_NESTING    "He maha nga wa kei te karanga"
 #define CTR_ERR_KNF        "Kīhai i kitea:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kaore e taea te tautapa ki te rereketanga kore-mohio:"
 #define CTR_ERR_EXEC       "Kaore e taea te whakahaere whakahau"
 #define CTR_MSG_DSC_FILE  "file"
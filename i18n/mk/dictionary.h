@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Лажни"
 #define CTR_DICT_NUMBER           "Број"
 #define CTR_DICT_STRING           "Текст"
+#define CTR_DICT_BUFFER          "Бафер"
 #define CTR_DICT_TASK       "Код"
 #define CTR_DICT_OBJECT           "Објект"
 #define CTR_DICT_ARRAY_OBJECT      "Листа"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "буле"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "помеѓу:и:"
 #define CTR_DICT_LENGTH	          "должина"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "од:должина:"
 #define CTR_DICT_TRIM	          "отстранете-ги-околните-простори"
 #define CTR_DICT_AT               "на:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "придружи-се:"
 #define CTR_DICT_POP              "поп"
 #define CTR_DICT_SORT             "вид:"
+#define CTR_DICT_SORT_NATURAL    "вид"
+#define CTR_DICT_SORT_BY         "вид-по:"
 #define CTR_DICT_PUT_AT           "стави:на:"
 #define CTR_DICT_MAP              "мапа:"
 #define CTR_DICT_EACH             "секој:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Мора да се врати [Булеан].\n"
 #define CTR_ERR_NESTING    "Премногу вгнездени повици"
 #define CTR_ERR_KNF        "Клучот не е пронајден:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Не може да се додели на недефинирана променлива:"
 #define CTR_ERR_EXEC       "Не може да се изврши командата"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "തെറ്റായ"
 #define CTR_DICT_NUMBER           "നമ്പർ"
 #define CTR_DICT_STRING           "സ്ട്രിംഗ്"
+#define CTR_DICT_BUFFER          "ബഫർ"
 #define CTR_DICT_TASK       "കോഡ്"
 #define CTR_DICT_OBJECT           "വസ്തു"
 #define CTR_DICT_ARRAY_OBJECT      "പട്ടിക"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "തീരുമാനിക്കുക"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ഇടയിൽ:ഒപ്പം:"
 #define CTR_DICT_LENGTH	          "നീളം"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "നിന്ന്:നീളം:"
 #define CTR_DICT_TRIM	          "ചുറ്റുമുള്ള-ഇടങ്ങൾ-നീക്കംചെയ്യുക"
 #define CTR_DICT_AT               "ഇവിടെ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ചേരുക:"
 #define CTR_DICT_POP              "പോപ്പ്"
 #define CTR_DICT_SORT             "അടുക്കുക:"
+#define CTR_DICT_SORT_NATURAL    "അടുക്കുക"
+#define CTR_DICT_SORT_BY         "അടുക്കുക-അനുസരിച്ച്:"
 #define CTR_DICT_PUT_AT           "വസ്തു:സ്ഥാനം:"
 #define CTR_DICT_MAP              "മാപ്പിംഗ്:"
 #define CTR_DICT_EACH             "ഓരോന്നും:"
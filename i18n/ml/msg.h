@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "മടങ്ങണം [ബൂളിയൻ].\n"
 #define CTR_ERR_NESTING    "വളരെയധികം നെസ്റ്റഡ് കോളുകൾ"
 #define CTR_ERR_KNF        "കീ കണ്ടെത്തിയില്ല:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "നിർവചിക്കാത്ത വേരിയബിളിലേക്ക് നിയോഗിക്കാൻ കഴിയില്ല:"
 #define CTR_ERR_EXEC       "കമാൻഡ് എക്സിക്യൂട്ട് ചെയ്യാൻ കഴിയില്ല"
 #define CTR_MSG_DSC_FILE  "file"
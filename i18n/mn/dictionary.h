@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Үгүй"
 #define CTR_DICT_NUMBER           "Тоо"
 #define CTR_DICT_STRING           "Текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "ажил"
 #define CTR_DICT_OBJECT           "Обьект"
 #define CTR_DICT_ARRAY_OBJECT      "Цуврал"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "хооронд:мөн:"
 #define CTR_DICT_LENGTH	          "урт"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "байршил:урт:"
 #define CTR_DICT_TRIM	          "хүрээлэн-буй-зайг-арилгах"
 #define CTR_DICT_AT               "үед:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "нэгдэх:"
 #define CTR_DICT_POP              "авах-арын"
 #define CTR_DICT_SORT             "ангилах:"
+#define CTR_DICT_SORT_NATURAL    "ангилах"
+#define CTR_DICT_SORT_BY         "ангилах-дагуу:"
 #define CTR_DICT_PUT_AT           "объект:байршил:"
 #define CTR_DICT_MAP              "жагсаалт:"
 #define CTR_DICT_EACH             "тус-бүр:"
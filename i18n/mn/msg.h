@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Буцах ёстой [Boolean].\n"
 #define CTR_ERR_NESTING    "Хэт олон дуудлага хийгдсэн байна"
 #define CTR_ERR_KNF        "Түлхүүр олдсонгүй:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Тодорхойгүй хувьсагч руу хуваарилж чадахгүй:"
 #define CTR_ERR_EXEC       "Тушаалыг гүйцэтгэх боломжгүй байна"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Nu"
 #define CTR_DICT_NUMBER           "Number"
 #define CTR_DICT_STRING           "Striŋ"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Obđect"
 #define CTR_DICT_ARRAY_OBJECT      "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "būlean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "betłeen:and:"
 #define CTR_DICT_LENGTH	          "leŋż"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "from:leŋż:"
 #define CTR_DICT_TRIM	          "remove-surrūndiŋ-spaces"
 #define CTR_DICT_AT               "vek:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "đoin:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "sort:"
+#define CTR_DICT_SORT_NATURAL    "sort"
+#define CTR_DICT_SORT_BY         "sort-by:"
 #define CTR_DICT_PUT_AT           "pune:la:"
 #define CTR_DICT_MAP              "serieă:"
 #define CTR_DICT_EACH             "eač:"
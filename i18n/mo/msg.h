@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "must return [Būlean].\n"
 #define CTR_ERR_NESTING    "tū manj nested calls"
 #define CTR_ERR_KNF        "kej ban fūnd:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "cannot assign sta undefined variable:"
 #define CTR_ERR_EXEC       "unable sta execute command"
 #define CTR_MSG_DSC_FILE  "file"
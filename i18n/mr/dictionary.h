@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "खोटे"
 #define CTR_DICT_NUMBER           "संख्या"
 #define CTR_DICT_STRING           "स्ट्रिंग"
+#define CTR_DICT_BUFFER          "बफर"
 #define CTR_DICT_TASK       "कोड"
 #define CTR_DICT_OBJECT           "ऑब्जेक्ट"
 #define CTR_DICT_ARRAY_OBJECT      "यादी"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "_बुलियन"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "मध्ये आणि:__:"
 #define CTR_DICT_LENGTH	          "लांबी"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "पासून:लांबी:"
 #define CTR_DICT_TRIM	          "आसपासची मोकळी जागा काढा"
 #define CTR_DICT_AT               "येथे:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "सामील व्हा:"
 #define CTR_DICT_POP              "पॉप"
 #define CTR_DICT_SORT             "क्रमवारी लावा:"
+#define CTR_DICT_SORT_NATURAL    "क्रमवारी-लावा"
+#define CTR_DICT_SORT_BY         "क्रमवारी-लावा-नुसार:"
 #define CTR_DICT_PUT_AT           "ठेवले:येथे:"
 #define CTR_DICT_MAP              "_नकाशा:"
 #define CTR_DICT_EACH             "प्रत्येक:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "परत पाहिजे [बुलियन].\n"
 #define CTR_ERR_NESTING    "बर्‍याच नेस्टेड कॉल"
 #define CTR_ERR_KNF        "की आढळली नाही:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "अपरिभाषित व्हेरिएबलला नियुक्त करू शकत नाही:"
 #define CTR_ERR_EXEC       "कमांड कार्यान्वित करण्यात अक्षम"
 #define CTR_MSG_DSC_FILE  "फाइल"
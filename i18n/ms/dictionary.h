@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Salah"
 #define CTR_DICT_NUMBER           "Nombor"
 #define CTR_DICT_STRING           "Teks"
+#define CTR_DICT_BUFFER          "Penimbal"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Objek"
 #define CTR_DICT_ARRAY_OBJECT      "Senarai"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "antara:dan:"
 #define CTR_DICT_LENGTH	          "panjang"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "dari:panjang:"
 #define CTR_DICT_TRIM	          "keluarkan-ruang-sekeliling"
 #define CTR_DICT_AT               "di:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "sertai:"
 #define CTR_DICT_POP              "dapatkan-objek-terakhir"
 #define CTR_DICT_SORT             "semak:"
+#define CTR_DICT_SORT_NATURAL    "semak"
+#define CTR_DICT_SORT_BY         "semak-ikut:"
 #define CTR_DICT_PUT_AT           "meletakkan:pada:"
 #define CTR_DICT_MAP              "peta:"
 #define CTR_DICT_EACH             "setiap:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Mesti kembali [Boolean].\n"
 #define CTR_ERR_NESTING    "Terlalu banyak panggilan bersarang"
 #define CTR_ERR_KNF        "Kunci tidak dijumpai:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Tidak boleh menyerah kepada pembolehubah yang tidak ditentukan:"
 #define CTR_ERR_EXEC       "Tidak dapat melaksanakan perintah"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falz"
 #define CTR_DICT_NUMBER           "Numru"
 #define CTR_DICT_STRING           "Test"
+#define CTR_DICT_BUFFER          "Baffer"
 #define CTR_DICT_TASK       "Kompitu"
 #define CTR_DICT_OBJECT           "Oġġett"
 #define CTR_DICT_ARRAY_OBJECT      "Serje"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "bejn:u:"
 #define CTR_DICT_LENGTH	          "it-tul"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "minn:tul:"
 #define CTR_DICT_TRIM	          "neħħi-l-ispazji-tal-madwar"
 #define CTR_DICT_AT               "fi:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "jingħaqdu:"
 #define CTR_DICT_POP              "ħu-l-aħħar"
 #define CTR_DICT_SORT             "ordni:"
+#define CTR_DICT_SORT_NATURAL    "ordni"
+#define CTR_DICT_SORT_BY         "ordni-skont:"
 #define CTR_DICT_PUT_AT           "tpoġġi:fi:"
 #define CTR_DICT_MAP              "mappa:"
 #define CTR_DICT_EACH             "kull-waħda:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Trid tirritorna [Boolean].\n"
 #define CTR_ERR_NESTING    "Wisq sejħiet imbarazz"
 #define CTR_ERR_KNF        "Ċavetta li ma nstabitx:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ma tistax tassenja għal varjabbli mhux definita:"
 #define CTR_ERR_EXEC       "Mhux possibbli li tesegwixxi kmand"
 #define CTR_MSG_DSC_FILE  "file"
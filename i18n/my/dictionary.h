@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "မဟုတ်ဘူး"
 #define CTR_DICT_NUMBER           "နံပါတ်"
 #define CTR_DICT_STRING           "စာသား"
+#define CTR_DICT_BUFFER          "ဘဖာ"
 #define CTR_DICT_TASK       "အလုပ်"
 #define CTR_DICT_OBJECT           "အရာဝတ္ထု"
 #define CTR_DICT_ARRAY_OBJECT      "စီးရီး"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ဆုံးဖြတ်ချက်"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "အကြား:နှင့်:"
 #define CTR_DICT_LENGTH	          "အရှည်"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "မှ:အရှည်:"
 #define CTR_DICT_TRIM	          "ပတျဝနျးကငျြနေရာများဖယ်ရှားလိုက်ပါ"
 #define CTR_DICT_AT               "မှာ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ပူးပေါင်းမည်:"
 #define CTR_DICT_POP              "နောက်ဆုံးပစ္စည်းကိုယူပါ"
 #define CTR_DICT_SORT             "မျိုး:"
+#define CTR_DICT_SORT_NATURAL    "မျိုး"
+#define CTR_DICT_SORT_BY         "မျိုး-အလိုက်:"
 #define CTR_DICT_PUT_AT           "ရွှေ့:သို့:"
 #define CTR_DICT_MAP              "စာရင်း:"
 #define CTR_DICT_EACH             "တစ်ခုချင်းစီကို:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ပြန်လာရမည် [Boolean].\n"
 #define CTR_ERR_NESTING    "အလွန်များစွာသောအသိုက်ဖုန်းခေါ်ဆိုမှု။"
 #define CTR_ERR_KNF        "သော့မတွေ့ပါ။"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "undefined variable ကိုသတ်မှတ်လို့မရပါဘူး။"
 #define CTR_ERR_EXEC       "command ကို execute မရပါ။"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "छैन"
 #define CTR_DICT_NUMBER           "संख्या"
 #define CTR_DICT_STRING           "पाठ"
+#define CTR_DICT_BUFFER          "बफर"
 #define CTR_DICT_TASK       "कोड"
 #define CTR_DICT_OBJECT           "वस्तु"
 #define CTR_DICT_ARRAY_OBJECT      "शृङ्खला"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "निर्णय"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "बीचमा:र:"
 #define CTR_DICT_LENGTH	          "लम्बाइ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "बाट:लम्बाई:"
 #define CTR_DICT_TRIM	          "वरपरका-ठाउँहरू-हटाउनुहोस्"
 #define CTR_DICT_AT               "मा:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "सामेल-हुनुहोस्:"
 #define CTR_DICT_POP              "अन्तिम-वस्तु-लिनुहोस्"
 #define CTR_DICT_SORT             "क्रमबद्ध-गर्नुहोस्:"
+#define CTR_DICT_SORT_NATURAL    "क्रमबद्ध-गर्नुहोस्"
+#define CTR_DICT_SORT_BY         "क्रमबद्ध-गर्नुहोस्-अनुसार:"
 #define CTR_DICT_PUT_AT           "राख्नुहोस्:मा:"
 #define CTR_DICT_MAP              "सूची:"
 #define CTR_DICT_EACH             "प्रत्येक:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "फर्कनु पर्छ [बुलियन].\n"
 #define CTR_ERR_NESTING    "धेरै नै नेस्ट गरिएको कलहरू।"
 #define CTR_ERR_KNF        "कुञ्जी भेटिएन:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "अपरिभाषित चरमा असाइन गर्न सकिँदैन:"
 #define CTR_ERR_EXEC       "आदेश कार्यान्वयन गर्न असमर्थ।"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Nee"
 #define CTR_DICT_NUMBER          "Getal"
 #define CTR_DICT_STRING          "Tekst"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK            "Taak"
 #define CTR_DICT_OBJECT          "Object"
 #define CTR_DICT_ARRAY_OBJECT    "Reeks"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "bool" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "tussen:en:" 
 #define CTR_DICT_LENGTH	         "lengte" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "van:lengte:" 
 #define CTR_DICT_TRIM	         "kern" 
 #define CTR_DICT_AT              "bij:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "samenvoegen:" 
 #define CTR_DICT_POP             "rknip"
 #define CTR_DICT_SORT            "sorteren:" 
+#define CTR_DICT_SORT_NATURAL    "sorteren"
+#define CTR_DICT_SORT_BY         "sorteren-op:"
 #define CTR_DICT_PUT_AT          "zet:bij:" 
 #define CTR_DICT_MAP             "lijst:" 
 #define CTR_DICT_EACH            "elk:"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falsk"
 #define CTR_DICT_NUMBER           "Tall"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK             "Oppgave"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Rad"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "mellom:og:"
 #define CTR_DICT_LENGTH	          "lengde"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "fra:lengde:"
 #define CTR_DICT_TRIM	          "fjerne-omkringliggende-områder"
 #define CTR_DICT_AT               "på:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "bli-med:"
 #define CTR_DICT_POP              "ta-sist"
 #define CTR_DICT_SORT             "sortere:"
+#define CTR_DICT_SORT_NATURAL    "sortere"
+#define CTR_DICT_SORT_BY         "sortere-etter:"
 #define CTR_DICT_PUT_AT           "sagt:at:"
 #define CTR_DICT_MAP              "liste:"
 #define CTR_DICT_EACH             "hver:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Må tilbake [Boolean].\n"
 #define CTR_ERR_NESTING    "For mange nestede samtaler"
 #define CTR_ERR_KNF        "Nøkkel ikke funnet:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kan ikke tilordne en udefinert variabel:"
 #define CTR_ERR_EXEC       "Kan ikke utføre kommando"
 #define CTR_MSG_DSC_FILE  "file"
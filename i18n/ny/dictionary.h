@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Zabodza"
 #define CTR_DICT_NUMBER           "Chiwerengero"
 #define CTR_DICT_STRING           "Mawu"
+#define CTR_DICT_BUFFER          "Bafa"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Cholinga"
 #define CTR_DICT_ARRAY_OBJECT      "Mndandanda"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "pakati:ndi:"
 #define CTR_DICT_LENGTH	          "kutalika"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "kuchokera:kutalika:"
 #define CTR_DICT_TRIM	          "chotsani-malo-oyandikana-nawo"
 #define CTR_DICT_AT               "pa-malo:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "lowani:"
 #define CTR_DICT_POP              "gwira-chinthu-chomaliza"
 #define CTR_DICT_SORT             "pamzere:"
+#define CTR_DICT_SORT_NATURAL    "pamzere"
+#define CTR_DICT_SORT_BY         "pamzere-ndi:"
 #define CTR_DICT_PUT_AT           "ikani:pa:"
 #define CTR_DICT_MAP              "map:"
 #define CTR_DICT_EACH             "iliyonse:"
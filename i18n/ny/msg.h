@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ayenera kubwerera [Boolean].\n"
 #define CTR_ERR_NESTING    "Mafoni ochuluka kwambiri"
 #define CTR_ERR_KNF        "Mfungulo sinapezeke:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Simungapereke kutanthauzira kosamveka:"
 #define CTR_ERR_EXEC       "Takanika kupereka lamulo"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Soba"
 #define CTR_DICT_NUMBER          "Lakkoofsa"
 #define CTR_DICT_STRING          "Barreeffama"
+#define CTR_DICT_BUFFER          "Buufara"
 #define CTR_DICT_TASK            "Hojii"
 #define CTR_DICT_OBJECT          "Wanta"
 #define CTR_DICT_ARRAY_OBJECT    "Walduraa-duuba"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "dhugaa-sobaa"
 #define CTR_DICT_RANDOM_NUM_BETWEEN  "gidduu:fi:"
 #define CTR_DICT_LENGTH	         "dheerina"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH     "irraa:dheerina:"
 #define CTR_DICT_TRIM            "halaga-naannawa-balleessi"
 #define CTR_DICT_AT              "bakka:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "waliingalchi:"
 #define CTR_DICT_POP             "buqqisi"
 #define CTR_DICT_SORT            "tarreessi:"
+#define CTR_DICT_SORT_NATURAL    "tarreessi"
+#define CTR_DICT_SORT_BY         "tarreessi-tiin:"
 #define CTR_DICT_PUT_AT          "kaa'i:itti:"
 #define CTR_DICT_MAP             "maapin:"
 #define CTR_DICT_EACH            "hundaaf:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Boolean deebisuu qabda."
 #define CTR_ERR_NESTING   "Walkeessa galchuu baay'ee.\n"
 #define CTR_ERR_KNF       "Furtuu hin argamne: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Variable hin jirreef ramaduu hin danda'amu: "
 #define CTR_ERR_EXEC      "Ajaja raabsuu hin dandeenye."
 #define CTR_MSG_DSC_FILE  "faayilii"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ମିଥ୍ୟା"
 #define CTR_DICT_NUMBER           "ସଂଖ୍ୟା"
 #define CTR_DICT_STRING           "ପାଠ"
+#define CTR_DICT_BUFFER          "ବଫର୍"
 #define CTR_DICT_TASK       "କୋଡ୍"
 #define CTR_DICT_OBJECT           "ବସ୍ତୁ"
 #define CTR_DICT_ARRAY_OBJECT      "ତାଲିକା"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ବୁଲିଅନ୍"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ମଧ୍ୟରେ:ଏବଂ:"
 #define CTR_DICT_LENGTH	          "ଲମ୍ବ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ଠାରୁ:ଲମ୍ବ:"
 #define CTR_DICT_TRIM	          "ଆଖପାଖ ସ୍ଥାନଗୁଡିକ ଅପସାରଣ କରନ୍ତୁ"
 #define CTR_DICT_AT               "ସ୍ଥାନ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ଯୋଗ ଦିଅନ୍ତୁ:"
 #define CTR_DICT_POP              "ପପ୍"
 #define CTR_DICT_SORT             "ସର୍ଟ:"
+#define CTR_DICT_SORT_NATURAL    "ସର୍ଟ"
+#define CTR_DICT_SORT_BY         "ସର୍ଟ-ଅନୁସାରେ:"
 #define CTR_DICT_PUT_AT           "ବସ୍ତୁ:ସ୍ଥାନ:"
 #define CTR_DICT_MAP              "ମ୍ୟାପିଂ:"
 #define CTR_DICT_EACH             "ପ୍ରତ୍ୟେକ:"
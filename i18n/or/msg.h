@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ନିଶ୍ଚୟ ଫେରିବ | [ବୁଲିଅନ୍ |].\n"
 #define CTR_ERR_NESTING    "ଅତ୍ୟଧିକ ନେଷ୍ଟେଡ୍ କଲ୍ |"
 #define CTR_ERR_KNF        "ଚାବି ମିଳିଲା ନାହିଁ:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ଅଜ୍ଞାତ ଭେରିଏବଲ୍ କୁ ନ୍ୟସ୍ତ କରିପାରିବ ନାହିଁ:"
 #define CTR_ERR_EXEC       "କମାଣ୍ଡ୍ ଏକଜେକ୍ୟୁଟ୍ କରିବାକୁ ଅସମର୍ଥ |"
 #define CTR_MSG_DSC_FILE  "file"
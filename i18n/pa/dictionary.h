@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ਗਲਤ"
 #define CTR_DICT_NUMBER           "ਗਿਣਤੀ"
 #define CTR_DICT_STRING           "ਟੈਕਸਟ"
+#define CTR_DICT_BUFFER          "ਬਫਰ"
 #define CTR_DICT_TASK       "ਕੋਡ"
 #define CTR_DICT_OBJECT           "ਆਬਜੈਕਟ"
 #define CTR_DICT_ARRAY_OBJECT      "ਸੂਚੀ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ਫੈਸਲਾ"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ਵਿਚਕਾਰ:ਅਤੇ:"
 #define CTR_DICT_LENGTH	          "ਲੰਬਾਈ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ਤੋਂ:ਲੰਬਾਈ:"
 #define CTR_DICT_TRIM	          "ਆਸ-ਪਾਸ-ਦੀਆਂ-ਥਾਵਾਂ-ਨੂੰ-ਹਟਾਓ"
 #define CTR_DICT_AT               "ਤੇ:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ਜੁੜੋ:"
 #define CTR_DICT_POP              "ਆਖਰੀ-ਵਸਤੂ-ਨੂੰ-ਫੜੋ"
 #define CTR_DICT_SORT             "ਲੜੀਬੱਧ:"
+#define CTR_DICT_SORT_NATURAL    "ਲੜੀਬੱਧ"
+#define CTR_DICT_SORT_BY         "ਲੜੀਬੱਧ-ਅਨੁਸਾਰ:"
 #define CTR_DICT_PUT_AT           "ਪਾ:ਤੇ:"
 #define CTR_DICT_MAP              "ਜੋੜੇ:"
 #define CTR_DICT_EACH             "ਹਰੇਕ:"
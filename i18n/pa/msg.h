@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ਵਾਪਸ ਆਉਣਾ ਚਾਹੀਦਾ ਹੈ [ਬੂਲੀਅਨ].\n"
 #define CTR_ERR_NESTING    "ਬਹੁਤ ਸਾਰੀਆਂ ਨੇਸਟਡ ਕਾਲਾਂ"
 #define CTR_ERR_KNF        "ਕੁੰਜੀ ਨਹੀਂ ਮਿਲੀ:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ਪਰਿਭਾਸ਼ਤ ਵੇਰੀਏਬਲ ਨੂੰ ਨਿਰਧਾਰਤ ਨਹੀਂ ਕੀਤਾ ਜਾ ਸਕਦਾ:"
 #define CTR_ERR_EXEC       "ਕਮਾਂਡ ਚਲਾਉਣ ਲਈ ਅਸਮਰੱਥ ਹੈ"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "No"
 #define CTR_DICT_NUMBER          "Number"
 #define CTR_DICT_STRING          "Teksto"
+#define CTR_DICT_BUFFER          "Bufer"
 #define CTR_DICT_TASK      "Trabou"
 #define CTR_DICT_OBJECT          "Opheto"
 #define CTR_DICT_ARRAY_OBJECT     "Sèt"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "sí-òf-nò" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "entre:i:" 
 #define CTR_DICT_LENGTH	         "largura" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "di:largura:" 
 #define CTR_DICT_TRIM	         "kita-espasio-na-blanku" 
 #define CTR_DICT_AT              "na:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "asina:" 
 #define CTR_DICT_POP             "kita" 
 #define CTR_DICT_SORT            "dirigí-na:" 
+#define CTR_DICT_SORT_NATURAL    "dirigí-na"
+#define CTR_DICT_SORT_BY         "dirigí-na-pa:"
 #define CTR_DICT_PUT_AT          "perde:na:" 
 #define CTR_DICT_MAP             "loke:" 
 #define CTR_DICT_EACH            "kada:"
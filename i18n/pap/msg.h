@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Mester bin bek su mes òf nò"
 #define CTR_ERR_NESTING   "Diesdos laman unidos."
 #define CTR_ERR_KNF       "Mi No a topa e clave: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Mi No por wòrdu asina na karibe individu: "
 #define CTR_ERR_EXEC      "No por ehekutá e komando."
 #define CTR_MSG_DSC_FILE  "fiel"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Nie"
 #define CTR_DICT_NUMBER           "Numer"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Bufor"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Obiekt"
 #define CTR_DICT_ARRAY_OBJECT      "Serio"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "pomiędzy:i:"
 #define CTR_DICT_LENGTH	          "długość"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "od:długość:"
 #define CTR_DICT_TRIM	          "usuń-otaczające-spacje"
 #define CTR_DICT_AT               "w:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "przystąp:"
 #define CTR_DICT_POP              "muzyka-pop"
 #define CTR_DICT_SORT             "sortować:"
+#define CTR_DICT_SORT_NATURAL    "sortować"
+#define CTR_DICT_SORT_BY         "sortować-według:"
 #define CTR_DICT_PUT_AT           "że:jest:"
 #define CTR_DICT_MAP              "lista:"
 #define CTR_DICT_EACH             "każdy:"
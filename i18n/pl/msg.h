@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Musi powrócić [Boolean].\n"
 #define CTR_ERR_NESTING    "Zbyt wiele zagnieżdżonych połączeń"
 #define CTR_ERR_KNF        "Klucza nie znaleziono:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nie można przypisać do niezdefiniowanej zmiennej:"
 #define CTR_ERR_EXEC       "Nie można wykonać polecenia"
 #define CTR_MSG_DSC_FILE  "file"
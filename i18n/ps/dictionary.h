@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "غلط"
 #define CTR_DICT_NUMBER           "شمیره"
 #define CTR_DICT_STRING           "متن"
+#define CTR_DICT_BUFFER          "بفر"
 #define CTR_DICT_TASK       "کوډ"
 #define CTR_DICT_OBJECT           "څيز"
 #define CTR_DICT_ARRAY_OBJECT      "لیست"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "پریکړه"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "تر-منځ:او:"
 #define CTR_DICT_LENGTH	          "اوږدوالی"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "له:اوږدوالي:"
 #define CTR_DICT_TRIM	          "شاوخوا-ځایونه-لرې-کړئ"
 #define CTR_DICT_AT               "په:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ګډون-کول:"
 #define CTR_DICT_POP              "پاپ"
 #define CTR_DICT_SORT             "ترتیب:"
+#define CTR_DICT_SORT_NATURAL    "ترتیب"
+#define CTR_DICT_SORT_BY         "ترتیب-له-مخې:"
 #define CTR_DICT_PUT_AT           "لګول:په:"
 #define CTR_DICT_MAP              "_نقشه:"
 #define CTR_DICT_EACH             "هر-یو:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "باید بیرته راشي [بولین].\n"
 #define CTR_ERR_NESTING    "ډیر ځنډول شوي زنګونه"
 #define CTR_ERR_KNF        "کیلي ونه موندل شوه:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "نامعلوم ټاکل شوی متغیره نشي ټاکل کیدلی:"
 #define CTR_ERR_EXEC       "د بولۍ د پلي کولو توان نلري"
 #define CTR_MSG_DSC_FILE  "file"
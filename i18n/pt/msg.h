@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Deve retornar [Boleano].\n"
 #define CTR_ERR_NESTING    "Muitas chamadas aninhadas"
 #define CTR_ERR_KNF        "Chave não encontrada:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Não é possível atribuir a variável indefinida:"
 #define CTR_ERR_EXEC       "Não foi possível executar o comando"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Falso"
 #define CTR_DICT_NUMBER          "Número"
 #define CTR_DICT_STRING          "String"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK      "Código"
 #define CTR_DICT_OBJECT          "Objeto"
 #define CTR_DICT_ARRAY_OBJECT     "Listar"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "boleano"
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "entre:e:"
 #define CTR_DICT_LENGTH	         "comprimento"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "de:comprimento:"
 #define CTR_DICT_TRIM	         "retira-os-espaços-ao-redor"
 #define CTR_DICT_AT              "em:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "juntar:"
 #define CTR_DICT_POP             "pop"
 #define CTR_DICT_SORT            "oedenar:"
+#define CTR_DICT_SORT_NATURAL    "oedenar"
+#define CTR_DICT_SORT_BY         "oedenar-por:"
 #define CTR_DICT_PUT_AT          "colocar:em:"
 #define CTR_DICT_MAP             "mapa:"
 #define CTR_DICT_EACH            "cada-um:"
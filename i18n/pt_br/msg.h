@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Precisa retornar um boleano."
 #define CTR_ERR_NESTING   "Muitas chamadas aninhadas."
 #define CTR_ERR_KNF       "Chave não encontrada: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Não pode atribuir para uma variável indefinida: "
 #define CTR_ERR_EXEC      "Incapaz de executar o comando."
 #define CTR_MSG_DSC_FILE  "arquivo"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Llulla"
 #define CTR_DICT_NUMBER          "Yupay"
 #define CTR_DICT_STRING          "Qillqa"
+#define CTR_DICT_BUFFER          "Waqaychana"
 #define CTR_DICT_TASK            "Ruway"
 #define CTR_DICT_OBJECT          "Ima"
 #define CTR_DICT_ARRAY_OBJECT    "Katiray"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "chiqapcha"
 #define CTR_DICT_RANDOM_NUM_BETWEEN  "chawpi:wan:"
 #define CTR_DICT_LENGTH	         "suni"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH     "manta:suni:"
 #define CTR_DICT_TRIM            "muyuriq-k'ichiykuna-qichuy"
 #define CTR_DICT_AT              "maypi:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "huñuy:"
 #define CTR_DICT_POP             "hurquy"
 #define CTR_DICT_SORT            "kamachiy:"
+#define CTR_DICT_SORT_NATURAL    "kamachiy"
+#define CTR_DICT_SORT_BY         "kamachiy-rayku:"
 #define CTR_DICT_PUT_AT          "churay:maypi:"
 #define CTR_DICT_MAP             "mapa:"
 #define CTR_DICT_EACH            "sapallanpaq:"
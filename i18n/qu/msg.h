@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Chiqapchasqawan kutichinayki."
 #define CTR_ERR_NESTING   "Nisyu ukhu yaykunakuna.\n"
 #define CTR_ERR_KNF       "Llave mana tarisqachu: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Mana atinchu mana kaq variablita churapuyta: "
 #define CTR_ERR_EXEC      "Mana atinchu kamachinata chaskiyta."
 #define CTR_MSG_DSC_FILE  "khipu"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Fals"
 #define CTR_DICT_NUMBER          "Număr"
 #define CTR_DICT_STRING          "String"
+#define CTR_DICT_BUFFER          "Tampon"
 #define CTR_DICT_TASK      "Cod"
 #define CTR_DICT_OBJECT          "Obiect"
 #define CTR_DICT_ARRAY_OBJECT     "Listă"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "boolean" 
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "între:şi:" 
 #define CTR_DICT_LENGTH	         "lungime" 
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "de-la:lungime:" 
 #define CTR_DICT_TRIM	         "şterge-spaţiile-din-jur" 
 #define CTR_DICT_AT              "la:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "alătură:" 
 #define CTR_DICT_POP             "scoate" 
 #define CTR_DICT_SORT            "sortează:" 
+#define CTR_DICT_SORT_NATURAL    "sortează"
+#define CTR_DICT_SORT_BY         "sortează-după:"
 #define CTR_DICT_PUT_AT          "pune:la:" 
 #define CTR_DICT_MAP             "map:" 
 #define CTR_DICT_EACH            "fiecare:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Trebuie să returneze un boolean."
 #define CTR_ERR_NESTING   "Prea multe apelări încapsulate unele in altele."
 #define CTR_ERR_KNF       "Cheia nu a fost găsită: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Nu poate fi dată o valoare unei variabile nedefinite: "
 #define CTR_ERR_EXEC      "Comanda nu a putut fi executată."
 #define CTR_MSG_DSC_FILE  "fişier"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Ложь"
 #define CTR_DICT_NUMBER          "Число"
 #define CTR_DICT_STRING          "текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK      "Код"
 #define CTR_DICT_OBJECT          "Объект"
 #define CTR_DICT_ARRAY_OBJECT     "Список"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "к-логическому-значению"
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "между:и:"
 #define CTR_DICT_LENGTH	         "длина"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "от:длина:"
 #define CTR_DICT_TRIM	         "удалить-окружающие-пробелы"
 #define CTR_DICT_AT              "в:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "присоединить:"
 #define CTR_DICT_POP             "удалить-последний-элемент"
 #define CTR_DICT_SORT            "сортировать:"
+#define CTR_DICT_SORT_NATURAL    "сортировать"
+#define CTR_DICT_SORT_BY         "сортировать-по:"
 #define CTR_DICT_PUT_AT          "разместить:в:"
 #define CTR_DICT_MAP             "карта:"
 #define CTR_DICT_EACH            "каждый:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Должен возвращать логическое значение."
 #define CTR_ERR_NESTING   "Слишком много вложенных вызовов."
 #define CTR_ERR_KNF       "Ключ не найден: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Невозможно присвоить неопределенную переменную: "
 #define CTR_ERR_EXEC      "Невозможно выполнить команду."
 #define CTR_MSG_DSC_FILE  "файл"
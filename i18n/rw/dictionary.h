@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Oya"
 #define CTR_DICT_NUMBER           "Umubare"
 #define CTR_DICT_STRING           "Inyandiko"
+#define CTR_DICT_BUFFER          "Ububiko"
 #define CTR_DICT_TASK       "Akazi"
 #define CTR_DICT_OBJECT           "Intego"
 #define CTR_DICT_ARRAY_OBJECT      "Urutonde"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "yego-oya"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "hagati:na:"
 #define CTR_DICT_LENGTH	          "uburebure"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "kuva:uburebure:"
 #define CTR_DICT_TRIM	          "kuraho-ibibanza-bikikije"
 #define CTR_DICT_AT               "kuri:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "injira:"
 #define CTR_DICT_POP              "fata-icya-nyuma"
 #define CTR_DICT_SORT             "kuri-gahunda:"
+#define CTR_DICT_SORT_NATURAL    "kuri-gahunda"
+#define CTR_DICT_SORT_BY         "kuri-gahunda-ku:"
 #define CTR_DICT_PUT_AT           "shyira:kuri:"
 #define CTR_DICT_MAP              "ikarita:"
 #define CTR_DICT_EACH             "buri:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Ugomba kugaruka [Boolean].\n"
 #define CTR_ERR_NESTING    "Hamagara cyane"
 #define CTR_ERR_KNF        "Urufunguzo ntirwabonetse:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ntushobora kugenera impinduka zidasobanutse:"
 #define CTR_ERR_EXEC       "Ntibishoboka gukora itegeko"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE "وڙو"
 #define CTR_DICT_NUMBER "مبر"
 #define CTR_DICT_STRING "متن"
+#define CTR_DICT_BUFFER          "بفر"
 #define CTR_DICT_TASK "وڊ"
 #define CTR_DICT_OBJECT "قصد"
 #define CTR_DICT_ARRAY_OBJECT "سٽ"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL "َيربِينير"
 #define CTR_DICT_RANDOM_NUM_BETWEEN "چ:۽:"
 #define CTR_DICT_LENGTH "يگهه"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH "ان:ڊيگهه:"
 #define CTR_DICT_TRIM "رپاسيواريجڳههختمڪريو"
 #define CTR_DICT_AT "ي:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN "املٿيو:"
 #define CTR_DICT_POP "اپ"
 #define CTR_DICT_SORT "سم:"
+#define CTR_DICT_SORT_NATURAL    "ترتيب"
+#define CTR_DICT_SORT_BY         "ترتيب-مطابق:"
 #define CTR_DICT_PUT_AT "کيل:تي:"
 #define CTR_DICT_MAP "قشو:"
 #define CTR_DICT_EACH "_ر:"
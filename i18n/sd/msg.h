@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "ھڪ بولين ضرور موٽائڻ گھرجي."
 #define CTR_ERR_NESTING "تمام گھڻا گستاخ ڪالون."
 #define CTR_ERR_KNF "چاٻي نه مليو:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN "اڻ سڌريل متغير کي تفويض نٿو ڪري سگھجي:"
 #define CTR_ERR_EXEC "عمل ڪرڻ کان قاصر."
 #define CTR_MSG_DSC_FILE  "file"
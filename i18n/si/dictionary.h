@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "නැත"
 #define CTR_DICT_NUMBER           "අංකය"
 #define CTR_DICT_STRING           "පෙළ"
+#define CTR_DICT_BUFFER          "බෆරය"
 #define CTR_DICT_TASK       "කාර්යය"
 #define CTR_DICT_OBJECT           "වස්තුව"
 #define CTR_DICT_ARRAY_OBJECT      "ලැයිස්තුව"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "තීරණ"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "අතර:සහ:"
 #define CTR_DICT_LENGTH	          "දිග"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "සිට:දිග:"
 #define CTR_DICT_TRIM	          "අවට අවකාශය ඉවත් කරන්න"
 #define CTR_DICT_AT               "හිදී:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "මැලියම්:"
 #define CTR_DICT_POP              "අන්තිම එක ගන්න"
 #define CTR_DICT_SORT             "වර්ග කිරීම:"
+#define CTR_DICT_SORT_NATURAL    "වර්ග-කිරීම"
+#define CTR_DICT_SORT_BY         "වර්ග-කිරීම-අනුව:"
 #define CTR_DICT_PUT_AT           "වස්තුව:ස්ථානය:"
 #define CTR_DICT_MAP              "සිතියම:"
 #define CTR_DICT_EACH             "සෑම:"
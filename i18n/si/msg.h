@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "නැවත පැමිණිය යුතුය [බූලියන්].\n"
 #define CTR_ERR_NESTING    "කැදැලි ඇමතුම් වැඩියි"
 #define CTR_ERR_KNF        "යතුර හමු නොවීය:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "නිර්වචනය නොකළ විචල්‍යයට පැවරිය නොහැක:"
 #define CTR_ERR_EXEC       "විධානය ක්‍රියාත්මක කළ නොහැක"
 #define CTR_MSG_DSC_FILE  "file"
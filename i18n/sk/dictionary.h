@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Nepravdivý"
 #define CTR_DICT_NUMBER           "Číslo"
 #define CTR_DICT_STRING           "Text"
+#define CTR_DICT_BUFFER          "Zásobník"
 #define CTR_DICT_TASK             "Úloha"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Zoznam"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "medzi:a:"
 #define CTR_DICT_LENGTH	          "dĺžka"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "z:dĺžka:"
 #define CTR_DICT_TRIM	          "odstrániť-okolitý-priestor"
 #define CTR_DICT_AT               "na-adrese:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pripojiť:"
 #define CTR_DICT_POP              "vezmite-posledný"
 #define CTR_DICT_SORT             "radiť:"
+#define CTR_DICT_SORT_NATURAL    "radiť"
+#define CTR_DICT_SORT_BY         "radiť-podľa:"
 #define CTR_DICT_PUT_AT           "povedané:na-adrese:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "každý:"
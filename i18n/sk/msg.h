@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Musí sa vrátiť [Boolean].\n"
 #define CTR_ERR_NESTING    "Príliš veľa vnorených hovorov"
 #define CTR_ERR_KNF        "Kľúč nebol nájdený:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nedá sa priradiť k nedefinovanej premennej:"
 #define CTR_ERR_EXEC       "Nie je možné vykonať príkaz"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Lažno"
 #define CTR_DICT_NUMBER           "Številka"
 #define CTR_DICT_STRING           "Besedilo"
+#define CTR_DICT_BUFFER          "Medpomnilnik"
 #define CTR_DICT_TASK       "Koda"
 #define CTR_DICT_OBJECT           "Predmet"
 #define CTR_DICT_ARRAY_OBJECT      "Seznam"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "med:in:"
 #define CTR_DICT_LENGTH	          "dolžino"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "od:dolžina:"
 #define CTR_DICT_TRIM	          "odstranite-okoliške-prostore"
 #define CTR_DICT_AT               "ob:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "pridruži-se:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "razvrsti:"
+#define CTR_DICT_SORT_NATURAL    "razvrsti"
+#define CTR_DICT_SORT_BY         "razvrsti-po:"
 #define CTR_DICT_PUT_AT           "dal:na:"
 #define CTR_DICT_MAP              "zemljevid:"
 #define CTR_DICT_EACH             "vsak:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Mora se vrniti [Boolov].\n"
 #define CTR_ERR_NESTING    "Preveč ugnezdenih klicev"
 #define CTR_ERR_KNF        "Ključa ni mogoče najti:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Neznane spremenljivke ni mogoče dodeliti:"
 #define CTR_ERR_EXEC       "Ukaza ni mogoče izvesti"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Sese"
 #define CTR_DICT_NUMBER           "Numera"
 #define CTR_DICT_STRING           "Faʻailoga"
+#define CTR_DICT_BUFFER          "Pafa"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Sini"
 #define CTR_DICT_ARRAY_OBJECT      "Lisi"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "pupu"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "i-le-va-o:ma:"
 #define CTR_DICT_LENGTH	          "uumi"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "mai:uumi:"
 #define CTR_DICT_TRIM	          "aveese-nofoaga-lata-ane"
 #define CTR_DICT_AT               "i:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "auai:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "fa'atonuga:"
+#define CTR_DICT_SORT_NATURAL    "fa'atonuga"
+#define CTR_DICT_SORT_BY         "fa'atonuga-e-tusa-ai:"
 #define CTR_DICT_PUT_AT           "tuʻu:i:"
 #define CTR_DICT_MAP              "faʻafanua:"
 #define CTR_DICT_EACH             "taʻitasi:"
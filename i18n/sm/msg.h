@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "E tatau ona toe foi [Faʻamalie].\n"
 #define CTR_ERR_NESTING    "Tele tele telefoni faʻatonuina"
 #define CTR_ERR_KNF        "Key e le maua:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "E le mafai ona vaʻai i le fesuiaiga e le faʻamaonia:"
 #define CTR_ERR_EXEC       "Le mafai ona faia le faʻatonu"
 #define CTR_MSG_DSC_FILE  "file"
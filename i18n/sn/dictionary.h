@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Aihwa"
 #define CTR_DICT_NUMBER           "Nhamba"
 #define CTR_DICT_STRING           "Text"
+#define CTR_DICT_BUFFER          "Bhafa"
 #define CTR_DICT_TASK       "Code"
 #define CTR_DICT_OBJECT           "Chinhu"
 #define CTR_DICT_ARRAY_OBJECT      "Rondedzero"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "pakati:uye:"
 #define CTR_DICT_LENGTH	          "kureba"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "kubva:kureba:"
 #define CTR_DICT_TRIM	          "bvisa-nzvimbo-dzakakomberedza"
 #define CTR_DICT_AT               "pa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "joinha:"
 #define CTR_DICT_POP              "kubata-yekupedzisira"
 #define CTR_DICT_SORT             "kuisa-muhurongwa:"
+#define CTR_DICT_SORT_NATURAL    "kuisa-muhurongwa"
+#define CTR_DICT_SORT_BY         "kuisa-muhurongwa-na:"
 #define CTR_DICT_PUT_AT           "isa:pa:"
 #define CTR_DICT_MAP              "mepu:"
 #define CTR_DICT_EACH             "chimwe-nechimwe:"
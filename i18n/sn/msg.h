@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Unofanira kudzoka [Boolean].\n"
 #define CTR_ERR_NESTING    "Kune akawanda manhamba nested mafoni"
 #define CTR_ERR_KNF        "Kiyi haina kuwanikwa:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Haigoni kugovera kune isina kujekeswa shanduko:"
 #define CTR_ERR_EXEC       "Kutadza kuita murairo"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Maya"
 #define CTR_DICT_NUMBER           "Tirada"
 #define CTR_DICT_STRING           "Qoraal"
+#define CTR_DICT_BUFFER          "Kaydiye"
 #define CTR_DICT_TASK       "Foosha"
 #define CTR_DICT_OBJECT           "Walax"
 #define CTR_DICT_ARRAY_OBJECT      "Taxane"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "dhexeeya:iyo:"
 #define CTR_DICT_LENGTH	          "dherer"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ka:dherer:"
 #define CTR_DICT_TRIM	          "ka-saar-meelaha-ku-xeeran"
 #define CTR_DICT_AT               "ee:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ku-biir:"
 #define CTR_DICT_POP              "qaado-gadaale"
 #define CTR_DICT_SORT             "kala-saar:"
+#define CTR_DICT_SORT_NATURAL    "kala-saar"
+#define CTR_DICT_SORT_BY         "kala-saar-ku:"
 #define CTR_DICT_PUT_AT           "walax:meeshaas:"
 #define CTR_DICT_MAP              "liiska:"
 #define CTR_DICT_EACH             "mid-kasta:"
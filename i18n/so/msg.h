@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Waa inuu soo noqdaa [Boolean].\n"
 #define CTR_ERR_NESTING    "Wicitaan aad u badan oo la soo wiciyay"
 #define CTR_ERR_KNF        "Fure lama helin:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Lama siin karo doorsoome aan sharraxnayn:"
 #define CTR_ERR_EXEC       "Tulin karin amarka"
 #define CTR_MSG_DSC_FILE  "file"
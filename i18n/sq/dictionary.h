@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "I-rremë"
 #define CTR_DICT_NUMBER           "Numër"
 #define CTR_DICT_STRING           "Teksti"
+#define CTR_DICT_BUFFER          "Bufer"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Listë"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "midis:dhe:"
 #define CTR_DICT_LENGTH	          "gjatësi"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "nga:gjatësi:"
 #define CTR_DICT_TRIM	          "hequr-hapësira-rrethuese"
 #define CTR_DICT_AT               "në:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "bashkohen:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "lloj:"
+#define CTR_DICT_SORT_NATURAL    "rendit"
+#define CTR_DICT_SORT_BY         "rendit-sipas:"
 #define CTR_DICT_PUT_AT           "vënë:në:"
 #define CTR_DICT_MAP              "harta:"
 #define CTR_DICT_EACH             "secili:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Duhet të kthehet [Boolean].\n"
 #define CTR_ERR_NESTING    "Shumë thirrje fole"
 #define CTR_ERR_KNF        "Keyelësi nuk u gjet:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Nuk mund të caktohet në ndryshoren e papërcaktuar:"
 #define CTR_ERR_EXEC       "Në pamundësi për të ekzekutuar komandën"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Лажно"
 #define CTR_DICT_NUMBER           "Број"
 #define CTR_DICT_STRING           "Tекст"
+#define CTR_DICT_BUFFER          "Бафер"
 #define CTR_DICT_TASK       "Код"
 #define CTR_DICT_OBJECT           "Објект"
 #define CTR_DICT_ARRAY_OBJECT      "Листа"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "боолеан"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "између:и:"
 #define CTR_DICT_LENGTH	          "дужина"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "од:дужина:"
 #define CTR_DICT_TRIM	          "уклоните-околне-просторе"
 #define CTR_DICT_AT               "у:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "придружити:"
 #define CTR_DICT_POP              "поп"
 #define CTR_DICT_SORT             "врста:"
+#define CTR_DICT_SORT_NATURAL    "врста"
+#define CTR_DICT_SORT_BY         "врста-по:"
 #define CTR_DICT_PUT_AT           "пут:ат:"
 #define CTR_DICT_MAP              "mапа:"
 #define CTR_DICT_EACH             "сваки:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Мора се вратити [Боолеан].\n"
 #define CTR_ERR_NESTING    "Превише угнијежђених позива"
 #define CTR_ERR_KNF        "Кључ није пронађен:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Не може се доделити неодређеној променљивој:"
 #define CTR_ERR_EXEC       "Није могуће извршити наредбу"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Che"
 #define CTR_DICT_NUMBER           "Palo"
 #define CTR_DICT_STRING           "Mongolo"
+#define CTR_DICT_BUFFER          "Bafa"
 #define CTR_DICT_TASK       "Sebetsa"
 #define CTR_DICT_OBJECT           "Ntho"
 #define CTR_DICT_ARRAY_OBJECT      "Letoto"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "pakeng-tsa:le:"
 #define CTR_DICT_LENGTH	          "bolelele"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ho-tloha:bolelele:"
 #define CTR_DICT_TRIM	          "tlosa-libaka-tse-o-potileng"
 #define CTR_DICT_AT               "ka:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ikopanye:"
 #define CTR_DICT_POP              "kepisi"
 #define CTR_DICT_SORT             "ho-hlopha:"
+#define CTR_DICT_SORT_NATURAL    "ho-hlopha"
+#define CTR_DICT_SORT_BY         "ho-hlopha-ka:"
 #define CTR_DICT_PUT_AT           "beha:ka:"
 #define CTR_DICT_MAP              "lethathamo:"
 #define CTR_DICT_EACH             "e-']ngoe-le-e']-ngoe:"
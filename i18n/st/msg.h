@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "E tlameha ho khutla [Boolean].\n"
 #define CTR_ERR_NESTING    "Mehala e mengata haholo e hlophisitsoeng"
 #define CTR_ERR_KNF        "Senotlolo ha se fumanehe:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ha e khone ho fana ka phetoho e sa hlalosoang:"
 #define CTR_ERR_EXEC       "Ha e khone ho etsa taelo"
 #define CTR_MSG_DSC_FILE  "file"
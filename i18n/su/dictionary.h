@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Palsu"
 #define CTR_DICT_NUMBER           "Nomer"
 #define CTR_DICT_STRING           "Téks"
+#define CTR_DICT_BUFFER          "Panyangga"
 #define CTR_DICT_TASK       "Kode"
 #define CTR_DICT_OBJECT           "Obyek"
 #define CTR_DICT_ARRAY_OBJECT      "Daptar"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "antara:jeung:"
 #define CTR_DICT_LENGTH	          "panjang"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "tina:panjang:"
 #define CTR_DICT_TRIM	          "miceun-rohangan-sakurilingna"
 #define CTR_DICT_AT               "tabuh:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ngiluan:"
 #define CTR_DICT_POP              "prune"
 #define CTR_DICT_SORT             "diurutkeun:"
+#define CTR_DICT_SORT_NATURAL    "diurutkeun"
+#define CTR_DICT_SORT_BY         "diurutkeun-dumasar:"
 #define CTR_DICT_PUT_AT           "nempatkeun:di:"
 #define CTR_DICT_MAP              "peta:"
 #define CTR_DICT_EACH             "masing-masing:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kedah uih deui [Boolean].\n"
 #define CTR_ERR_NESTING    "Seueur sauran nénu"
 #define CTR_ERR_KNF        "Konci henteu kapendak:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Teu tiasa ngadaptarkeun kana variabel anu teu ditangtukeun:"
 #define CTR_ERR_EXEC       "Teu tiasa ngalaksanakeun paréntah"
 #define CTR_MSG_DSC_FILE  "file"
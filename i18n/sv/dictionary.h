@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Falsk"
 #define CTR_DICT_NUMBER           "Siffra"
 #define CTR_DICT_STRING           "Text"
+#define CTR_DICT_BUFFER          "Buffert"
 #define CTR_DICT_TASK       "Uppgift"
 #define CTR_DICT_OBJECT           "Objekt"
 #define CTR_DICT_ARRAY_OBJECT      "Serie"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "mellan:och:"
 #define CTR_DICT_LENGTH	          "längd"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "från:längd:"
 #define CTR_DICT_TRIM	          "avlägsna-omgivande-utrymmen"
 #define CTR_DICT_AT               "på:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ansluta-sig:"
 #define CTR_DICT_POP              "ta-sist"
 #define CTR_DICT_SORT             "sortera:"
+#define CTR_DICT_SORT_NATURAL    "sortera"
+#define CTR_DICT_SORT_BY         "sortera-efter:"
 #define CTR_DICT_PUT_AT           "sätta:vid:"
 #define CTR_DICT_MAP              "lista:"
 #define CTR_DICT_EACH             "varje:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Måste återvända [Boolean].\n"
 #define CTR_ERR_NESTING    "För många kapslade samtal"
 #define CTR_ERR_KNF        "Nyckel hittades inte:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kan inte tilldela en odefinierad variabel:"
 #define CTR_ERR_EXEC       "Det gick inte att utföra kommandot"
 #define CTR_MSG_DSC_FILE  "file"
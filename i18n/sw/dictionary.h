@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Hapana"
 #define CTR_DICT_NUMBER           "Nambari"
 #define CTR_DICT_STRING           "Maandishi"
+#define CTR_DICT_BUFFER          "Bafa"
 #define CTR_DICT_TASK       "Kazi"
 #define CTR_DICT_OBJECT           "Kitu"
 #define CTR_DICT_ARRAY_OBJECT      "Msururu"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "kati-ya:na:"
 #define CTR_DICT_LENGTH	          "urefu"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "kutoka:urefu:"
 #define CTR_DICT_TRIM	          "ondoa-nafasi-zilizo-karibu"
 #define CTR_DICT_AT               "katika:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "jiunge:"
 #define CTR_DICT_POP              "kuchukua-mwisho"
 #define CTR_DICT_SORT             "aina:"
+#define CTR_DICT_SORT_NATURAL    "panga"
+#define CTR_DICT_SORT_BY         "panga-kwa:"
 #define CTR_DICT_PUT_AT           "weka:saa:"
 #define CTR_DICT_MAP              "orodha:"
 #define CTR_DICT_EACH             "kila-moja:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Lazima kurudi [Boolean].\n"
 #define CTR_ERR_NESTING    "Simu nyingi zilizowekwa"
 #define CTR_ERR_KNF        "Ufunguo haujapatikana:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Haiwezi kupeana tafsiri isiyoelezewa:"
 #define CTR_ERR_EXEC       "Haiwezi kutekeleza amri"
 #define CTR_MSG_DSC_FILE  "file"
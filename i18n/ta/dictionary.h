@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "பொய்"
 #define CTR_DICT_NUMBER           "எண்"
 #define CTR_DICT_STRING           "உரை"
+#define CTR_DICT_BUFFER          "இடையகம்"
 #define CTR_DICT_TASK       "பணி"
 #define CTR_DICT_OBJECT           "பொருள்"
 #define CTR_DICT_ARRAY_OBJECT      "வரிசை"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "முடிவுரை"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "இடையில்:மற்றும்:"
 #define CTR_DICT_LENGTH	          "நீளம்"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "இருந்து:நீளம்:"
 #define CTR_DICT_TRIM	          "சுற்றியுள்ள-இடங்களை-அகற்றவும்"
 #define CTR_DICT_AT               "இல்:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "சேர:"
 #define CTR_DICT_POP              "கடைசி-பொருளைப்-பிடிக்கவும்"
 #define CTR_DICT_SORT             "வகைபடுத்து:"
+#define CTR_DICT_SORT_NATURAL    "வகைபடுத்து"
+#define CTR_DICT_SORT_BY         "வகைபடுத்து-படி:"
 #define CTR_DICT_PUT_AT           "நகர்த்து:முதல்:"
 #define CTR_DICT_MAP              "பட்டியல்-கொடுக்க்:"
 #define CTR_DICT_EACH             "ஒவ்வொன்றும்:"
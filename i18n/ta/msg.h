@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "திரும்ப வேண்டும் [பூலியன்].\n"
 #define CTR_ERR_NESTING    "அதிகமான உள்ளமை அழைப்புகள்"
 #define CTR_ERR_KNF        "விசை கிடைக்கவில்லை:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "வரையறுக்கப்படாத மாறிக்கு ஒதுக்க முடியாது:"
 #define CTR_ERR_EXEC       "கட்டளையை இயக்க முடியவில்லை"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "తప్పుడు"
 #define CTR_DICT_NUMBER           "సంఖ్య"
 #define CTR_DICT_STRING           "వచనము"
+#define CTR_DICT_BUFFER          "బఫర్"
 #define CTR_DICT_TASK       "కోడ్"
 #define CTR_DICT_OBJECT           "ఆబ్జెక్ట్"
 #define CTR_DICT_ARRAY_OBJECT      "జాబితా"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "అవును-లేదా-కాదు"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "సంఖ్య-నుండి:వరకు:"
 #define CTR_DICT_LENGTH	          "పొడవు"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "నుండి:పొడవు:"
 #define CTR_DICT_TRIM	          "పరిసర-ప్రదేశాలు-తొలగించడానికి"
 #define CTR_DICT_AT               "వద్ద:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "చేరడానికి:"
 #define CTR_DICT_POP              "చివరి-మూలకాన్ని-తీసుకోండి"
 #define CTR_DICT_SORT             "క్రమం:"
+#define CTR_DICT_SORT_NATURAL    "క్రమం"
+#define CTR_DICT_SORT_BY         "క్రమం-ప్రకారం:"
 #define CTR_DICT_PUT_AT           "చాలు:వద్ద:"
 #define CTR_DICT_MAP              "జంటలు:"
 #define CTR_DICT_EACH             "ప్రతి:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "తిరిగి రావాలి [బూలియన్].\n"
 #define CTR_ERR_NESTING    "చాలా సమూహ కాల్‌లు"
 #define CTR_ERR_KNF        "కీ కనుగొనబడలేదు:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "నిర్వచించబడని వేరియబుల్‌కు కేటాయించలేము:"
 #define CTR_ERR_EXEC       "ఆదేశాన్ని అమలు చేయడం సాధ్యం కాలేదు"
 #define CTR_MSG_DSC_FILE  "file"
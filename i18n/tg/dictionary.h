@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Не"
 #define CTR_DICT_NUMBER           "Шумора"
 #define CTR_DICT_STRING           "Матни"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK             "Вазифаи"
 #define CTR_DICT_OBJECT           "Объекти"
 #define CTR_DICT_ARRAY_OBJECT      "Рӯйхат"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ҳа-ё-не"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "миёни:ва:"
 #define CTR_DICT_LENGTH	          "дарозӣ"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "аз:дарозӣ:"
 #define CTR_DICT_TRIM	          "тоза"
 #define CTR_DICT_AT               "дар:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "ҳамроҳ-шудан:"
 #define CTR_DICT_POP              "бурида-суффикс"
 #define CTR_DICT_SORT             "навъ:"
+#define CTR_DICT_SORT_NATURAL    "навъ"
+#define CTR_DICT_SORT_BY         "навъ-аз-рӯи:"
 #define CTR_DICT_PUT_AT           "гузошта:дар:"
 #define CTR_DICT_MAP              "харита:"
 #define CTR_DICT_EACH             "ҳар-як:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Бояд баргардад [Були].\n"
 #define CTR_ERR_NESTING    "Зангҳои бешумор ворид карда шуданд"
 #define CTR_ERR_KNF        "Калид ёфт нашуд:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ба тағирёбандаи номаълум таъин карда намешавад:"
 #define CTR_ERR_EXEC       "Фармонро иҷро карда намешавад"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "ไม่"
 #define CTR_DICT_NUMBER           "จำนวน"
 #define CTR_DICT_STRING           "คำ"
+#define CTR_DICT_BUFFER          "บัฟเฟอร์"
 #define CTR_DICT_TASK       "รหัส"
 #define CTR_DICT_OBJECT           "วัตถุ"
 #define CTR_DICT_ARRAY_OBJECT      "ชุด"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "บูล"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "ระหว่าง:ถึง:"
 #define CTR_DICT_LENGTH	          "ความยาว"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "จาก:ยาว:"
 #define CTR_DICT_TRIM	          "ลบช่องว่างโดยรอบ"
 #define CTR_DICT_AT               "ที่:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "เข้าร่วม:"
 #define CTR_DICT_POP              "ใช้รายการสุดท้าย"
 #define CTR_DICT_SORT             "จัดเรียง:"
+#define CTR_DICT_SORT_NATURAL    "จัดเรียง"
+#define CTR_DICT_SORT_BY         "จัดเรียง-ตาม:"
 #define CTR_DICT_PUT_AT           "วาง:ที่:"
 #define CTR_DICT_MAP              "หนังสือ:"
 #define CTR_DICT_EACH             "แต่ละ:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "จะต้องกลับมา [บูลีน].\n"
 #define CTR_ERR_NESTING    "มีการโทรซ้อนหลายครั้งเกินไป"
 #define CTR_ERR_KNF        "ไม่พบรหัส:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ไม่สามารถกำหนดให้กับตัวแปรที่ไม่ได้กำหนด:"
 #define CTR_ERR_EXEC       "ไม่สามารถเรียกใช้งานคำสั่ง"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Sealňyş"
 #define CTR_DICT_NUMBER           "San"
 #define CTR_DICT_STRING           "Tekst"
+#define CTR_DICT_BUFFER          "Bufer"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Obýekt"
 #define CTR_DICT_ARRAY_OBJECT      "Seriýa"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "arasynda:we:"
 #define CTR_DICT_LENGTH	          "uzynlygy"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "dan:uzynlyk:"
 #define CTR_DICT_TRIM	          "töwerekdäki-ýerleri-aýyryň"
 #define CTR_DICT_AT               "at:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "goşul:"
 #define CTR_DICT_POP              "iň-soňkusyny-al"
 #define CTR_DICT_SORT             "sort:"
+#define CTR_DICT_SORT_NATURAL    "sort"
+#define CTR_DICT_SORT_BY         "sort-by:"
 #define CTR_DICT_PUT_AT           "obýekt:ýeri:"
 #define CTR_DICT_MAP              "sanaw:"
 #define CTR_DICT_EACH             "hersi:"
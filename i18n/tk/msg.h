@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Yzyna gaýdyp gelmeli [Boolean].\n"
 #define CTR_ERR_NESTING    "Öýlenen jaňlar gaty köp"
 #define CTR_ERR_KNF        "Açar tapylmady:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Kesgitlenmedik üýtgeýjini belläp bolmaýar:"
 #define CTR_ERR_EXEC       "Buýrugy ýerine ýetirip bolmaýar"
 #define CTR_MSG_DSC_FILE  "file"
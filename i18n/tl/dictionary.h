@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Hindi"
 #define CTR_DICT_NUMBER           "Bilang"
 #define CTR_DICT_STRING           "Teksto"
+#define CTR_DICT_BUFFER          "Buffer"
 #define CTR_DICT_TASK             "Gawain"
 #define CTR_DICT_OBJECT           "Bagay"
 #define CTR_DICT_ARRAY_OBJECT      "Listahan"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "oo-o-hindi"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "sa-pagitan-ng:at:"
 #define CTR_DICT_LENGTH	          "haba"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "mula-sa:haba:"
 #define CTR_DICT_TRIM	          "alisin-ang-mga-nakapalibot-na-puwang"
 #define CTR_DICT_AT               "sa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "sumali:"
 #define CTR_DICT_POP              "kunin-ang-huling"
 #define CTR_DICT_SORT             "ayusin:"
+#define CTR_DICT_SORT_NATURAL    "ayusin"
+#define CTR_DICT_SORT_BY         "ayusin-ayon-sa:"
 #define CTR_DICT_PUT_AT           "ilagay:sa:"
 #define CTR_DICT_MAP              "mapa:"
 #define CTR_DICT_EACH             "bawat-isa:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kailangang bumalik [Boolean].\n"
 #define CTR_ERR_NESTING    "Masyadong maraming mga nested tawag"
 #define CTR_ERR_KNF        "Hindi natagpuan ang key:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Hindi maitatalaga sa hindi natukoy na variable:"
 #define CTR_ERR_EXEC       "Hindi maipatupad ang utos"
 #define CTR_MSG_DSC_FILE  "file"
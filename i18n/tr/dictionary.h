@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Yanlış"
 #define CTR_DICT_NUMBER           "Numara"
 #define CTR_DICT_STRING           "Metin"
+#define CTR_DICT_BUFFER          "Tampon"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Nesne"
 #define CTR_DICT_ARRAY_OBJECT      "Dizi"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boole"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "arasında:ve:"
 #define CTR_DICT_LENGTH	          "uzunluk"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "den:uzunluk:"
 #define CTR_DICT_TRIM	          "Çevre-boşlukları-kaldırın"
 #define CTR_DICT_AT               "en:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "katılmak:"
 #define CTR_DICT_POP              "sonuncuyu-al"
 #define CTR_DICT_SORT             "çeşit:"
+#define CTR_DICT_SORT_NATURAL    "çeşit"
+#define CTR_DICT_SORT_BY         "çeşit-göre:"
 #define CTR_DICT_PUT_AT           "koyun:at:"
 #define CTR_DICT_MAP              "map:"
 #define CTR_DICT_EACH             "her-biri:"
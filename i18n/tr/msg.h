@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Geri dönmelidir [Boole].\n"
 #define CTR_ERR_NESTING    "Çok fazla iç içe çağrı var"
 #define CTR_ERR_KNF        "Anahtar bulunamadı:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Tanımlanmamış değişkene atanamıyor:"
 #define CTR_ERR_EXEC       "Komut yürütülemiyor"
 #define CTR_MSG_DSC_FILE  "file"
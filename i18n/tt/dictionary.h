@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ялган"
 #define CTR_DICT_NUMBER           "Сан"
 #define CTR_DICT_STRING           "Текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "бурыч"
 #define CTR_DICT_OBJECT           "Объект"
 #define CTR_DICT_ARRAY_OBJECT      "Серияләре"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "буле"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "арасында:һәм:"
 #define CTR_DICT_LENGTH	          "озынлык"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "дан:озынлык:"
 #define CTR_DICT_TRIM	          "тирә-юньдәге-урыннарны-бетерегез"
 #define CTR_DICT_AT               "урын:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "кушыл:"
 #define CTR_DICT_POP              "кисү-суффикс"
 #define CTR_DICT_SORT             "сорт:"
+#define CTR_DICT_SORT_NATURAL    "сорт"
+#define CTR_DICT_SORT_BY         "сорт-буенча:"
 #define CTR_DICT_PUT_AT           "объект:урын:"
 #define CTR_DICT_MAP              "исемлек:"
 #define CTR_DICT_EACH             "һәрберсе:"
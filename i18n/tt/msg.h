@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Кайтырга тиеш [Булан].\n"
 #define CTR_ERR_NESTING    "Ояланган шалтыратулар бик күп"
 #define CTR_ERR_KNF        "Ачкыч табылмады:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Билгесез үзгәрүчене билгели алмый:"
 #define CTR_ERR_EXEC       "Команданы башкара алмый"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "يالغان"
 #define CTR_DICT_NUMBER           "سان"
 #define CTR_DICT_STRING           "String"
+#define CTR_DICT_BUFFER          "بۇففېر"
 #define CTR_DICT_TASK       "كود"
 #define CTR_DICT_OBJECT           "ئوبيېكت"
 #define CTR_DICT_ARRAY_OBJECT      "تىزىملىك"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "between:and:"
 #define CTR_DICT_LENGTH	          "ئۇزۇنلۇقى"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "from:length:"
 #define CTR_DICT_TRIM	          "ئەتراپتىكى-بوشلۇقلارنى-چىقىرىۋېتىڭ"
 #define CTR_DICT_AT               "at:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "join:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "sort:"
+#define CTR_DICT_SORT_NATURAL    "sort"
+#define CTR_DICT_SORT_BY         "sort-by:"
 #define CTR_DICT_PUT_AT           "put:at:"
 #define CTR_DICT_MAP              "_خەرىتە:"
 #define CTR_DICT_EACH             "ھەر-بىرى:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "چوقۇم قايتىشى كېرەك [Boolean].\n"
 #define CTR_ERR_NESTING    "ئۇۋىسى بەك كۆپ"
 #define CTR_ERR_KNF        "ئاچقۇچ تېپىلمىدى:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "ئېنىقلانمىغان ئۆزگەرگۈچى مىقدارغا تەقسىم قىلالمايدۇ:"
 #define CTR_ERR_EXEC       "بۇيرۇقنى ئىجرا قىلالمىدى"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Помилковий"
 #define CTR_DICT_NUMBER           "Номер"
 #define CTR_DICT_STRING           "Текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK       "Завдання"
 #define CTR_DICT_OBJECT           "Об’єкт"
 #define CTR_DICT_ARRAY_OBJECT      "Список"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "булева"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "між:та:"
 #define CTR_DICT_LENGTH	          "довжина"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "від:довжина:"
 #define CTR_DICT_TRIM	          "видаліть навколишні простори"
 #define CTR_DICT_AT               "за адресою:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "приєднатися:"
 #define CTR_DICT_POP              "візьміть останній предмет"
 #define CTR_DICT_SORT             "сортувати:"
+#define CTR_DICT_SORT_NATURAL    "сортувати"
+#define CTR_DICT_SORT_BY         "сортувати-за:"
 #define CTR_DICT_PUT_AT           "поставити:у:"
 #define CTR_DICT_MAP              "карта:"
 #define CTR_DICT_EACH             "кожен:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Повинно повернутися [Булева].\n"
 #define CTR_ERR_NESTING    "Забагато вкладених дзвінків"
 #define CTR_ERR_KNF        "Ключ не знайдено:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Неможливо призначити невизначеній змінній:"
 #define CTR_ERR_EXEC       "Неможливо виконати команду"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "جھوٹا"
 #define CTR_DICT_NUMBER           "نمبر"
 #define CTR_DICT_STRING           "متن"
+#define CTR_DICT_BUFFER          "بفر"
 #define CTR_DICT_TASK       "کوڈ"
 #define CTR_DICT_OBJECT           "چیز"
 #define CTR_DICT_ARRAY_OBJECT      "فہرست"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ہاں-یا-نہیں"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "درمیان:اور:"
 #define CTR_DICT_LENGTH	          "لمبائی"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "سے:لمبائی:"
 #define CTR_DICT_TRIM	          "آس-پاس-کی-جگہیں-ہٹا-دیں"
 #define CTR_DICT_AT               "پر:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "شامل-ہوں:"
 #define CTR_DICT_POP              "آخری-عنصر-لے-لو"
 #define CTR_DICT_SORT             "ترتیب-دیں:"
+#define CTR_DICT_SORT_NATURAL    "ترتیب-دیں"
+#define CTR_DICT_SORT_BY         "ترتیب-دیں-بمطابق:"
 #define CTR_DICT_PUT_AT           "ڈال:پر:"
 #define CTR_DICT_MAP              "نقشہ:"
 #define CTR_DICT_EACH             "ہر-ایک:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "لوٹنا ہوگا [بولین].\n"
 #define CTR_ERR_NESTING    "بہت سے گھریلو کالیں۔"
 #define CTR_ERR_KNF        "چابی نہیں ملی:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "غیر متعینہ متغیر کو تفویض نہیں کیا جاسکتا:"
 #define CTR_ERR_EXEC       "کمانڈ پر عملدرآمد کرنے سے قاصر ہے۔"
 #define CTR_MSG_DSC_FILE  "file"
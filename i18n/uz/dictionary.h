@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Yolg'on"
 #define CTR_DICT_NUMBER           "Raqam"
 #define CTR_DICT_STRING           "Matn"
+#define CTR_DICT_BUFFER          "Bufer"
 #define CTR_DICT_TASK       "Kod"
 #define CTR_DICT_OBJECT           "Ob'ekt"
 #define CTR_DICT_ARRAY_OBJECT      "Qator"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "mantiqiy"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "orasida:va:"
 #define CTR_DICT_LENGTH	          "uzunligi"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ushbudan:boshlab:"
 #define CTR_DICT_TRIM	          "atrofdagi-bo'shliqlarni-olib-tashlang"
 #define CTR_DICT_AT               "da:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "qo'shilish:"
 #define CTR_DICT_POP              "oxirgi-ob'ektni-oling"
 #define CTR_DICT_SORT             "saralash:"
+#define CTR_DICT_SORT_NATURAL    "saralash"
+#define CTR_DICT_SORT_BY         "saralash-bo'yicha:"
 #define CTR_DICT_PUT_AT           "qo'yish:da:"
 #define CTR_DICT_MAP              "xaritasi:"
 #define CTR_DICT_EACH             "har-biri:"
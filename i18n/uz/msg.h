@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Qaytish kerak [Boolean].\n"
 #define CTR_ERR_NESTING    "Ichki qo'ng'iroqlar juda ko'p"
 #define CTR_ERR_KNF        "Kalit topilmadi:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Belgilanmagan o'zgaruvchiga tayinlab bo'lmaydi:"
 #define CTR_ERR_EXEC       "Buyruqni bajarib bo'lmadi"
 #define CTR_MSG_DSC_FILE  "fayl"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Sai"
 #define CTR_DICT_NUMBER           "Con-số"
 #define CTR_DICT_STRING           "Văn-bản"
+#define CTR_DICT_BUFFER          "Bộ-đệm"
 #define CTR_DICT_TASK       "Mã"
 #define CTR_DICT_OBJECT           "Vật"
 #define CTR_DICT_ARRAY_OBJECT      "Loạt"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "giữa:và:"
 #define CTR_DICT_LENGTH	          "chiều-dài"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "từ:chiều-dài:"
 #define CTR_DICT_TRIM	          "loại-bỏ-không-gian-xung-quanh"
 #define CTR_DICT_AT               "tại:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "tham-gia:"
 #define CTR_DICT_POP              "lấy-phần-tử-cuối-cùng"
 #define CTR_DICT_SORT             "sắp-xếp:"
+#define CTR_DICT_SORT_NATURAL    "sắp-xếp"
+#define CTR_DICT_SORT_BY         "sắp-xếp-theo:"
 #define CTR_DICT_PUT_AT           "đặt:tại:"
 #define CTR_DICT_MAP              "sách:"
 #define CTR_DICT_EACH             "mỗi:"
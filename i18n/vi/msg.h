@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Phải trả lại [Boolean].\n"
 #define CTR_ERR_NESTING    "Quá nhiều cuộc gọi lồng nhau"
 #define CTR_ERR_KNF        "Không tìm thấy khóa:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Không thể gán cho biến không xác định:"
 #define CTR_ERR_EXEC       "Không thể thực thi lệnh"
 #define CTR_MSG_DSC_FILE  "file"
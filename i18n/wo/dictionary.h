@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "Dëkkul"
 #define CTR_DICT_NUMBER          "Lim"
 #define CTR_DICT_STRING          "Mbind"
+#define CTR_DICT_BUFFER          "Bifeer"
 #define CTR_DICT_TASK            "Liggéey"
 #define CTR_DICT_OBJECT          "Denc"
 #define CTR_DICT_ARRAY_OBJECT    "Jokkalante"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "dëppante"
 #define CTR_DICT_RANDOM_NUM_BETWEEN  "digante:ak:"
 #define CTR_DICT_LENGTH	         "guddaay"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH     "dale:guddaay:"
 #define CTR_DICT_TRIM            "jële-ruuj-diggante"
 #define CTR_DICT_AT              "ci:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "boole:"
 #define CTR_DICT_POP             "jële-ci-gannaaw"
 #define CTR_DICT_SORT            "tëgg:"
+#define CTR_DICT_SORT_NATURAL    "tëgg"
+#define CTR_DICT_SORT_BY         "tëgg-ci:"
 #define CTR_DICT_PUT_AT          "teg:ci:"
 #define CTR_DICT_MAP             "naat:"
 #define CTR_DICT_EACH            "kenn-ci-kenn:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "War nga delloo boolean."
 #define CTR_ERR_NESTING   "Woyof yi bari nañu torop."
 #define CTR_ERR_KNF       "Giseesu caabi bi: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Mënatul jox variable bu feeñul: "
 #define CTR_ERR_EXEC      "Mënatul doxal ndigal bi."
 #define CTR_MSG_DSC_FILE  "dencukaay"
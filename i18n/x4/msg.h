@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL     "Moet antwoorden met een waarheid."
 #define CTR_ERR_NESTING   "Teveel geneste aanroepen."
 #define CTR_ERR_KNF       "Sleutel niet gevonden: "
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN    "Kan geen waarde toekennen aan onbekende variabele: "
 #define CTR_ERR_EXEC      "Kan opdracht niet uitvoeren."
 #define CTR_MSG_DSC_FILE  "bestand"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Ubuxoki"
 #define CTR_DICT_NUMBER           "Inani"
 #define CTR_DICT_STRING           "Umbhalo"
+#define CTR_DICT_BUFFER          "Isigcini"
 #define CTR_DICT_TASK       "Ikhowudi"
 #define CTR_DICT_OBJECT           "Into"
 #define CTR_DICT_ARRAY_OBJECT      "Uthotho"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "phakathi:kunye:"
 #define CTR_DICT_LENGTH	          "ubude"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "ukusuka:ubude:"
 #define CTR_DICT_TRIM	          "susa-iindawo-ezikujikelezileyo"
 #define CTR_DICT_AT               "e:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "joyina:"
 #define CTR_DICT_POP              "pop"
 #define CTR_DICT_SORT             "uhlobo:"
+#define CTR_DICT_SORT_NATURAL    "uhlobo"
+#define CTR_DICT_SORT_BY         "uhlobo-nge:"
 #define CTR_DICT_PUT_AT           "beka:e:"
 #define CTR_DICT_MAP              "uluhlu:"
 #define CTR_DICT_EACH             "nganye:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kufuneka ubuye [Boolean].\n"
 #define CTR_ERR_NESTING    "Iifowuni ezininzi kakhulu ezenzelwe indawo"
 #define CTR_ERR_KNF        "Isitshixo asifumaneki:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ayinakusebenzisa umahluko ongachazwanga:"
 #define CTR_ERR_EXEC       "Ayikwazi ukwenza umyalelo"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE           "суох"
 #define CTR_DICT_NUMBER          "Чыыһыла"
 #define CTR_DICT_STRING          "текст"
+#define CTR_DICT_BUFFER          "Буфер"
 #define CTR_DICT_TASK      "Код"
 #define CTR_DICT_OBJECT          "Объект"
 #define CTR_DICT_ARRAY_OBJECT     "Испииһэк"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL          "к-логическому-значению"
 #define CTR_DICT_RANDOM_NUM_BETWEEN         "между:и:"
 #define CTR_DICT_LENGTH	         "уһуна"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	 "от:уһуна:"
 #define CTR_DICT_TRIM	         "тулалыыр-итэҕэстэри-ыраастаа"
 #define CTR_DICT_AT              "в:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN            "присоединить:"
 #define CTR_DICT_POP             "тиһэх-элемени-ЭС"
 #define CTR_DICT_SORT            "сортировкалаа:"
+#define CTR_DICT_SORT_NATURAL    "сортировкалаа"
+#define CTR_DICT_SORT_BY         "сортировкалаа-быһыытынан:"
 #define CTR_DICT_PUT_AT          "олоохсуй:в:"
 #define CTR_DICT_MAP             "карта:"
 #define CTR_DICT_EACH            "хас-биирдии-киһи:"
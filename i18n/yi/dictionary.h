@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "פאַלש"
 #define CTR_DICT_NUMBER           "נומער"
 #define CTR_DICT_STRING           "שטריקל"
+#define CTR_DICT_BUFFER          "באַפער"
 #define CTR_DICT_TASK       "קאָד"
 #define CTR_DICT_OBJECT           "כייפעץ"
 #define CTR_DICT_ARRAY_OBJECT      "רשימה"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "boolean"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "צווישן:און:"
 #define CTR_DICT_LENGTH	          "לענג"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "פֿון:לענג:"
 #define CTR_DICT_TRIM	          "אַראָפּנעמען אַרומיק ספּייסאַז"
 #define CTR_DICT_AT               "ביי:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "פאַרבינדן:"
 #define CTR_DICT_POP              "קנאַל"
 #define CTR_DICT_SORT             "סאָרט:"
+#define CTR_DICT_SORT_NATURAL    "סאָרט"
+#define CTR_DICT_SORT_BY         "סאָרט-לויט:"
 #define CTR_DICT_PUT_AT           "שטעלן:אין:"
 #define CTR_DICT_MAP              "מאַפּע:"
 #define CTR_DICT_EACH             "יעדער:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "מוזן צוריקקומען [Boolean].\n"
 #define CTR_ERR_NESTING    "צו פילע נעסטעד רופט"
 #define CTR_ERR_KNF        "שליסל נישט געפֿונען:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "קענען ניט באַשטימען צו ונדעפינעד בייַטעוודיק:"
 #define CTR_ERR_EXEC       "ניט געקענט צו דורכפירן באַפֿעלן"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Bẹẹkọ"
 #define CTR_DICT_NUMBER           "Nọmba"
 #define CTR_DICT_STRING           "Ọrọ"
+#define CTR_DICT_BUFFER          "Ibi-ipamọ"
 #define CTR_DICT_TASK       "Iṣẹ-ṣiṣe"
 #define CTR_DICT_OBJECT           "Nkan"
 #define CTR_DICT_ARRAY_OBJECT      "Jara"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "ariwo"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "laarin:ati:"
 #define CTR_DICT_LENGTH	          "gigun"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "lati:ipari:"
 #define CTR_DICT_TRIM	          "yọ-awọn-alafo-agbegbe"
 #define CTR_DICT_AT               "nipa:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "darapo:"
 #define CTR_DICT_POP              "gba-igbehin"
 #define CTR_DICT_SORT             "too:"
+#define CTR_DICT_SORT_NATURAL    "too"
+#define CTR_DICT_SORT_BY         "too-nipasẹ:"
 #define CTR_DICT_PUT_AT           "fi:nipa:"
 #define CTR_DICT_MAP              "akojọ:"
 #define CTR_DICT_EACH             "kọọkan:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Gbọdọ pada [Boolean].\n"
 #define CTR_ERR_NESTING    "Pupọ awọn ipe oni-nọmba"
 #define CTR_ERR_KNF        "Kokoro ko ri:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ko le firanṣẹ si oniyika ailopin:"
 #define CTR_ERR_EXEC       "Kò le ṣe pipaṣẹ"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "假"
 #define CTR_DICT_NUMBER           "數"
 #define CTR_DICT_STRING           "文本"
+#define CTR_DICT_BUFFER          "緩衝區"
 #define CTR_DICT_TASK             "碼"
 #define CTR_DICT_OBJECT           "物體"
 #define CTR_DICT_ARRAY_OBJECT     "系列"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "布爾值"
 #define CTR_DICT_RANDOM_NUM_BETWEEN "給出一個:到之間的隨機數:"
 #define CTR_DICT_LENGTH	          "長度"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "來自:長度:"
 #define CTR_DICT_TRIM	          "刪除周圍的空間"
 #define CTR_DICT_AT               "在:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "加入:"
 #define CTR_DICT_POP              "頂部元素"
 #define CTR_DICT_SORT             "分類:"
+#define CTR_DICT_SORT_NATURAL    "分類"
+#define CTR_DICT_SORT_BY         "分類依據:"
 #define CTR_DICT_PUT_AT           "将:设置为:"
 #define CTR_DICT_MAP              "列表:"
 #define CTR_DICT_EACH             "每:"
@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "必須退貨 [布爾型].\n"
 #define CTR_ERR_NESTING    "嵌套調用過多。"
 #define CTR_ERR_KNF        "找不到密鑰："
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "無法分配給未定義的變量："
 #define CTR_ERR_EXEC       "無法執行命令。"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "假"
 #define CTR_DICT_NUMBER           "数"
 #define CTR_DICT_STRING           "文本"
+#define CTR_DICT_BUFFER          "缓冲区"
 #define CTR_DICT_TASK             "码"
 #define CTR_DICT_OBJECT           "物体"
 #define CTR_DICT_ARRAY_OBJECT     "系列"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "布尔值"
 #define CTR_DICT_RANDOM_NUM_BETWEEN "给出一个:到之间的随机数:"
 #define CTR_DICT_LENGTH	          "长度"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "来自:长度:"
 #define CTR_DICT_TRIM	          "删除周围的空间"
 #define CTR_DICT_AT               "在:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "加入:"
 #define CTR_DICT_POP              "顶部元素"
 #define CTR_DICT_SORT             "分类:"
+#define CTR_DICT_SORT_NATURAL    "分类"
+#define CTR_DICT_SORT_BY         "分类依据:"
 #define CTR_DICT_PUT_AT           "把:和:"
 #define CTR_DICT_MAP              "列表:"
 #define CTR_DICT_EACH             "每:"
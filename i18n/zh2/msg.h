@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "必须退货 [布尔型].\n"
 #define CTR_ERR_NESTING    "嵌套调用过多。"
 #define CTR_ERR_KNF        "找不到密钥："
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "无法分配给未定义的变量："
 #define CTR_ERR_EXEC       "无法执行命令。"
 #define CTR_MSG_DSC_FILE  "file"
@@ -10,6 +10,7 @@
 #define CTR_DICT_FALSE            "Cha"
 #define CTR_DICT_NUMBER           "Inombolo"
 #define CTR_DICT_STRING           "Umbhalo"
+#define CTR_DICT_BUFFER          "Isigcini"
 #define CTR_DICT_TASK       "Ikhodi"
 #define CTR_DICT_OBJECT           "Into"
 #define CTR_DICT_ARRAY_OBJECT      "Uhlu"
@@ -77,6 +78,7 @@
 #define CTR_DICT_TOBOOL           "yebo-noma-cha"
 #define CTR_DICT_RANDOM_NUM_BETWEEN          "phakathi:no:"
 #define CTR_DICT_LENGTH	          "ubude"
+#define CTR_DICT_BYTES           "bytes"
 #define CTR_DICT_FROM_LENGTH	  "kusuka:ubude:"
 #define CTR_DICT_TRIM	          "khipha-izikhala-ezizungezile"
 #define CTR_DICT_AT               "e:"
@@ -98,6 +100,8 @@
 #define CTR_DICT_JOIN             "joyina:"
 #define CTR_DICT_POP              "thatha-yokugcina"
 #define CTR_DICT_SORT             "uhlobo:"
+#define CTR_DICT_SORT_NATURAL    "uhlobo"
+#define CTR_DICT_SORT_BY         "uhlobo-ngo:"
 #define CTR_DICT_PUT_AT           "beka:ngo:"
 #define CTR_DICT_MAP              "imephu:"
 #define CTR_DICT_EACH             "ngamunye:"
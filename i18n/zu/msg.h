@@ -46,6 +46,7 @@
 #define CTR_ERR_RBOOL "Kufanele abuye [Boolean].\n"
 #define CTR_ERR_NESTING    "Izingcingo eziningi kakhulu ezibekiwe"
 #define CTR_ERR_KNF        "Ukhiye awutholakali:"
+#define CTR_ERR_MAPMOD    "Map modified during iteration."
 #define CTR_ERR_ASSIGN     "Ayikwazi ukwabela kokuhlukahluka okungachazwanga:"
 #define CTR_ERR_EXEC       "Ayikwazi ukwenza umyalo"
 #define CTR_MSG_DSC_FILE  "file"
@@ -1,19 +1,24 @@
 #include "citrine.h"
 
-int ctr_clex_bflmt = 255;
 ctr_size ctr_clex_tokvlen = 0; /* length of the string value of a token */
-char* ctr_clex_buffer;
+char* ctr_clex_tokval = ""; /* string value of a token, usually a slice of the program */
 char* ctr_code;
 char* ctr_code_start;
 char* ctr_code_eoi;
 
 int ctr_clex_line_number;
+char* ctr_clex_line_start; /* first character of the current line */
+char* ctr_clex_token_start; /* first character of the current token */
 char* ctr_eofcode;
 
 char* ctr_clex_oldptr;
 char* ctr_clex_olderptr;
 int ctr_clex_old_line_number = 0;
 int ctr_clex_older_line_number = 0;
+char* ctr_clex_old_line_start;
+char* ctr_clex_older_line_start;
+char* ctr_clex_old_token_start;
+char* ctr_clex_older_token_start;
 int ctr_clex_ignore_modes = 0;
 int ctr_clex_number_of_lines = 0;
 char ctr_clex_param_prefix_char;
@@ -52,6 +57,8 @@ int ctr_clex_true_len = 0;
 int ctr_clex_false_len = 0;
 int ctr_clex_nil_len = 0;
 
+uint8_t ctr_clex_class[256];
+
 char* ivarname;
 int ivarlen;
 
@@ -62,6 +69,39 @@ int _isspace(char c) {
 	return (c == ' ' || c == '\t' || c == '\r' || c == '\n');
 }
 
+/**
+ * CTRLexerInitialize
+ *
+ * Classifies every byte by the role it might play in a program written
+ * with the current dictionary, so the lexer can tell whether a keyword
+ * might start at some position by looking up the first byte instead of
+ * comparing all keywords. Only the first byte of a keyword is classified,
+ * a byte having a class still requires a comparison of the keyword.
+ */
+void ctr_clex_initialize() {
+	int i;
+	char* keywords[] = { CTR_DICT_END_OF_LINE, CTR_DICT_MESSAGE_CHAIN, CTR_DICT_ASSIGN, ":=", CTR_DICT_RETURN, CTR_DICT_QUOT_OPEN, CTR_DICT_PARAMETER_PREFIX };
+	char* separators[] = { CTR_DICT_NUM_THO_SEP, CTR_DICT_NUM_DEC_SEP };
+	char* strings[] = { CTR_DICT_QUOT_OPEN, CTR_DICT_QUOT_CLOSE, "↵", "⇿", "\\", "\n" };
+	memset(ctr_clex_class, 0, sizeof(ctr_clex_class));
+	ctr_clex_class[(uint8_t) ' ']  |= CTR_CLEX_CLASS_SPACE | CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) '\t'] |= CTR_CLEX_CLASS_SPACE | CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) '\r'] |= CTR_CLEX_CLASS_SPACE | CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) '\n'] |= CTR_CLEX_CLASS_SPACE | CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) '(']  |= CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) ')']  |= CTR_CLEX_CLASS_DELIMITER;
+	ctr_clex_class[(uint8_t) ctr_clex_param_prefix_char] |= CTR_CLEX_CLASS_DELIMITER;
+	for (i = 0; i < sizeof(keywords) / sizeof(char*); i++) {
+		ctr_clex_class[(uint8_t) keywords[i][0]] |= CTR_CLEX_CLASS_KEYWORD;
+	}
+	for (i = 0; i < sizeof(separators) / sizeof(char*); i++) {
+		ctr_clex_class[(uint8_t) separators[i][0]] |= CTR_CLEX_CLASS_SEPARATOR;
+	}
+	for (i = 0; i < sizeof(strings) / sizeof(char*); i++) {
+		ctr_clex_class[(uint8_t) strings[i][0]] |= CTR_CLEX_CLASS_STRING;
+	}
+}
+
 /**
  * Lexer - is Symbol Delimiter ?
  * Determines whether the specified symbol is a delimiter.
@@ -72,6 +112,13 @@ int _isspace(char c) {
  * @return uint8_t
  */
 uint8_t ctr_clex_is_delimiter( char* code ) {
+	uint8_t class = ctr_clex_class[(uint8_t) *code];
+	if (class & CTR_CLEX_CLASS_DELIMITER) {
+		return 1;
+	}
+	if (!(class & CTR_CLEX_CLASS_KEYWORD)) {
+		return 0;
+	}
 	if (strncmp(code, CTR_DICT_END_OF_LINE, ctr_clex_keyword_eol_len) == 0) {
 		return 1;
 	}
@@ -87,16 +134,7 @@ uint8_t ctr_clex_is_delimiter( char* code ) {
 	if (strncmp(code, CTR_DICT_MESSAGE_CHAIN, ctr_clex_keyword_chain_len) == 0 ) {
 		return 1;
 	}
-	char symbol = *(code);
-	return (
-	   symbol == '('
-	|| symbol == ')'
-	|| symbol == ctr_clex_param_prefix_char
-	|| symbol == ' '
-	|| symbol == '\n'
-	|| symbol == '\t'
-	|| symbol == '\r'
-	);
+	return 0;
 }
 
 /**
@@ -112,7 +150,9 @@ void ctr_clex_emit_error( char* message ) {
 /**
  * CTRLexerLoad
  *
- * Loads program into memory.
+ * Loads program into memory. The values of references, numbers and
+ * strings are slices of the program text wherever possible, so the
+ * program text must be kept as long as the nodes parsed from it.
  */
 void ctr_clex_load(char* prg) {
 	ctr_clex_true_len = strlen(CTR_DICT_TRUE);
@@ -120,21 +160,59 @@ void ctr_clex_load(char* prg) {
 	ctr_clex_nil_len = strlen(CTR_DICT_NIL);
 	ctr_code = prg;
 	ctr_code_start = prg;
-	ctr_clex_buffer = ctr_heap_allocate_tracked(ctr_clex_bflmt);
-	ctr_clex_buffer[0] = '\0';
+	ctr_clex_tokval = "";
+	ctr_clex_tokvlen = 0;
 	ctr_eofcode = (ctr_code + ctr_program_length);
 	ctr_clex_line_number = 0;
+	ctr_clex_line_start = ctr_code;
+	ctr_clex_token_start = ctr_code;
 	ctr_code_start = ctr_code;
 }
 
+/**
+ * CTRLexerColumn
+ *
+ * Returns the column (1-based, in bytes) at which the current token
+ * starts, or 0 if the token spans several lines.
+ */
+uint32_t ctr_clex_column() {
+	if (ctr_clex_token_start < ctr_clex_line_start) return 0;
+	return (uint32_t) (ctr_clex_token_start - ctr_clex_line_start) + 1;
+}
+
 /**
  * CTRLexerTokenValue
  *
  * Returns the string of characters representing the value
- * of the currently selected token.
+ * of the currently selected token (not NUL-terminated, see
+ * ctr_clex_tok_value_length).
  */
 char* ctr_clex_tok_value() {
-	return ctr_clex_buffer;
+	return ctr_clex_tokval;
+}
+
+/**
+ * CTRLexerNumberValue
+ *
+ * Selects the number that has just been read as the value of the token.
+ * If the number contains thousands separators or a decimal separator other
+ * than the international one, the value is a normalized copy instead of
+ * a slice of the program.
+ */
+void ctr_clex_number_value(char* decimal, int normalize) {
+	char* p;
+	ctr_clex_tokval = ctr_clex_token_start;
+	ctr_clex_tokvlen = ctr_code - ctr_clex_token_start;
+	if (!normalize) return;
+	ctr_clex_tokval = ctr_heap_allocate_arena(ctr_clex_tokvlen);
+	ctr_clex_tokvlen = 0;
+	for(p = ctr_clex_token_start; p < ctr_code; p++) {
+		if (p == decimal) {
+			ctr_clex_tokval[ctr_clex_tokvlen++] = '.';
+		} else if (isdigit(*p) || p == ctr_clex_token_start) {
+			ctr_clex_tokval[ctr_clex_tokvlen++] = *p;
+		}
+	}
 }
 
 /**
@@ -219,6 +297,10 @@ void ctr_clex_putback() {
 	ctr_clex_oldptr = ctr_clex_olderptr;
 	ctr_clex_line_number = ctr_clex_old_line_number;
 	ctr_clex_old_line_number = ctr_clex_older_line_number;
+	ctr_clex_line_start = ctr_clex_old_line_start;
+	ctr_clex_old_line_start = ctr_clex_older_line_start;
+	ctr_clex_token_start = ctr_clex_old_token_start;
+	ctr_clex_old_token_start = ctr_clex_older_token_start;
 }
 
 /**
@@ -229,19 +311,28 @@ void ctr_clex_putback() {
  */
 int ctr_clex_tok() {
 	char c;
-	int i;
 	char eol;
+	char* decimal;
+	char* hash;
+	int normalize;
+	ctr_clex_tokval = "";
 	ctr_clex_tokvlen = 0;
 	ctr_clex_olderptr = ctr_clex_oldptr;
 	ctr_clex_oldptr = ctr_code;
 	ctr_clex_older_line_number = ctr_clex_old_line_number;
 	ctr_clex_old_line_number = ctr_clex_line_number;
-	i = 0;
+	ctr_clex_older_line_start = ctr_clex_old_line_start;
+	ctr_clex_old_line_start = ctr_clex_line_start;
+	ctr_clex_older_token_start = ctr_clex_old_token_start;
+	ctr_clex_old_token_start = ctr_clex_token_start;
 	c = *ctr_code;
 	for(;;) {
-		while(ctr_code != ctr_eofcode && (_isspace(c))) {
-			if (c == '\n') ctr_clex_line_number++;
+		while(ctr_code != ctr_eofcode && (ctr_clex_class[(uint8_t) c] & CTR_CLEX_CLASS_SPACE)) {
 			ctr_code ++;
+			if (c == '\n') {
+				ctr_clex_line_number++;
+				ctr_clex_line_start = ctr_code;
+			}
 			c = *ctr_code;
 		}
 		if (c == '#') {
@@ -253,52 +344,52 @@ int ctr_clex_tok() {
 			break;
 		}
 	}
+	ctr_clex_token_start = ctr_code;
 	if (ctr_code == ctr_eofcode) return CTR_TOKEN_FIN;
 	if (c == '(') { ctr_code++; return CTR_TOKEN_PAROPEN; }
 	if (c == ')') { ctr_code++; return CTR_TOKEN_PARCLOSE; }
 	if (c == '{') { ctr_code++; return CTR_TOKEN_BLOCKOPEN; }
 	if (c == '}') { ctr_code++; return CTR_TOKEN_BLOCKCLOSE; }
-	if (strncmp(ctr_code, CTR_DICT_END_OF_LINE, ctr_clex_keyword_eol_len)==0) {
-		ctr_code+=ctr_clex_keyword_eol_len;
-		return CTR_TOKEN_DOT;
-	}
-	if (strncmp(ctr_code, CTR_DICT_MESSAGE_CHAIN, ctr_clex_keyword_chain_len) == 0 ) {
-		 ctr_code+=ctr_clex_keyword_chain_len;
-		 return CTR_TOKEN_CHAIN;
-	}
-	if (strncmp(ctr_code, CTR_DICT_ASSIGN, ctr_clex_keyword_assignment_len)==0) {
-		ctr_code += ctr_clex_keyword_assignment_len;
-		return CTR_TOKEN_ASSIGNMENT; 
-	}
-	if (strncmp(ctr_code, ":=", 2)==0) {
-		ctr_code += 2;
-		return CTR_TOKEN_ASSIGNMENT;
-	}
-	if (c == ctr_clex_param_prefix_char) { ctr_code++; return CTR_TOKEN_COLON; }
-	if (strncmp(ctr_code, CTR_DICT_RETURN, ctr_clex_keyword_return_len)==0
-	&& *(ctr_code+ctr_clex_keyword_return_len)==' '
-	) {
-		ctr_code += ctr_clex_keyword_return_len;
-		return CTR_TOKEN_RET;
-	}
-	if (strncmp(ctr_code, CTR_DICT_QUOT_OPEN, ctr_clex_keyword_qo_len)==0) {
-		ctr_code+=ctr_clex_keyword_qo_len;
-		return CTR_TOKEN_QUOTE;
+	if (ctr_clex_class[(uint8_t) c] & CTR_CLEX_CLASS_KEYWORD) {
+		if (strncmp(ctr_code, CTR_DICT_END_OF_LINE, ctr_clex_keyword_eol_len)==0) {
+			ctr_code+=ctr_clex_keyword_eol_len;
+			return CTR_TOKEN_DOT;
+		}
+		if (strncmp(ctr_code, CTR_DICT_MESSAGE_CHAIN, ctr_clex_keyword_chain_len) == 0 ) {
+			 ctr_code+=ctr_clex_keyword_chain_len;
+			 return CTR_TOKEN_CHAIN;
+		}
+		if (strncmp(ctr_code, CTR_DICT_ASSIGN, ctr_clex_keyword_assignment_len)==0) {
+			ctr_code += ctr_clex_keyword_assignment_len;
+			return CTR_TOKEN_ASSIGNMENT; 
+		}
+		if (strncmp(ctr_code, ":=", 2)==0) {
+			ctr_code += 2;
+			return CTR_TOKEN_ASSIGNMENT;
+		}
+		if (c == ctr_clex_param_prefix_char) { ctr_code++; return CTR_TOKEN_COLON; }
+		if (strncmp(ctr_code, CTR_DICT_RETURN, ctr_clex_keyword_return_len)==0
+		&& *(ctr_code+ctr_clex_keyword_return_len)==' '
+		) {
+			ctr_code += ctr_clex_keyword_return_len;
+			return CTR_TOKEN_RET;
+		}
+		if (strncmp(ctr_code, CTR_DICT_QUOT_OPEN, ctr_clex_keyword_qo_len)==0) {
+			ctr_code+=ctr_clex_keyword_qo_len;
+			return CTR_TOKEN_QUOTE;
+		}
 	}
-	eol = ( strncmp(ctr_code,CTR_DICT_END_OF_LINE,ctr_clex_keyword_eol_len)==0 );
 	if ((c == '-' && (ctr_code+1)<ctr_eofcode && isdigit(*(ctr_code+1))) || isdigit(c)) {
+		decimal = NULL;
+		normalize = 0;
 		if (c == '-') {
-			ctr_clex_buffer[i] = c; ctr_clex_tokvlen++;
-			i++;
 			ctr_code++;
 			c = *ctr_code;
 		}
 		while(isdigit(c)){
-			ctr_clex_buffer[i++] = c;
-			ctr_clex_tokvlen++;
 			ctr_code++;
 			//thousands sep. found
-			if (strncmp(ctr_code,CTR_DICT_NUM_THO_SEP,ctr_clex_keyword_num_sep_tho_len)==0) {
+			if ((ctr_clex_class[(uint8_t) *ctr_code] & CTR_CLEX_CLASS_SEPARATOR) && strncmp(ctr_code,CTR_DICT_NUM_THO_SEP,ctr_clex_keyword_num_sep_tho_len)==0) {
 				//make sure the number continues afterwards, otherwise it might be another symbol like eol.
 				//but before we check that, make sure we don't reach the end of the code, otherwise we cause a segfault
 				if ((ctr_code+ctr_clex_keyword_num_sep_tho_len+1) <= ctr_eofcode) {
@@ -306,6 +397,7 @@ int ctr_clex_tok() {
 					if (isdigit(*(ctr_code+ctr_clex_keyword_num_sep_tho_len))) {
 						//ok fine, then, filter out number separator, and done.
 						ctr_code += ctr_clex_keyword_num_sep_tho_len;
+						normalize = 1;
 					}
 				}
 			}
@@ -313,6 +405,7 @@ int ctr_clex_tok() {
 		}
 		eol = ( strncmp(ctr_code,CTR_DICT_END_OF_LINE,ctr_clex_keyword_eol_len)==0 );
 		if (eol && (ctr_code+ctr_clex_keyword_eol_len <= ctr_eofcode) && !isdigit(*(ctr_code+ctr_clex_keyword_eol_len))) {
+			ctr_clex_number_value(decimal, normalize);
 			return CTR_TOKEN_NUMBER;
 		}
 		//Parse decimal separator (turn into international symbol .)
@@ -320,34 +413,36 @@ int ctr_clex_tok() {
 		((ctr_code+ctr_clex_keyword_num_sep_dec_len+1) <= ctr_eofcode) &&
 		isdigit(*(ctr_code+ctr_clex_keyword_num_sep_dec_len)) &&
 		strncmp(ctr_code,CTR_DICT_NUM_DEC_SEP,ctr_clex_keyword_num_sep_dec_len)==0) {
-			ctr_clex_buffer[i] = '.'; ctr_clex_tokvlen++;
-			i++;
+			decimal = ctr_code;
+			if (*decimal != '.') normalize = 1;
 			ctr_code++;
 			c = *ctr_code;
 		}
 		
 		while((isdigit(c))) {
-			ctr_clex_buffer[i] = c; ctr_clex_tokvlen++;
-			i++;
 			ctr_code++;
 			c = *ctr_code;
 		}
+		ctr_clex_number_value(decimal, normalize);
 		return CTR_TOKEN_NUMBER;
 	}
+	hash = NULL;
 	while( !ctr_clex_is_delimiter( ctr_code ) && ctr_code!=ctr_eofcode ) {
-		ctr_clex_buffer[i] = c;
-		if (c == '#' && i > 0) {
-			i = 0;
-			ctr_clex_tokvlen = 0;
-		}
-		ctr_clex_tokvlen++;
-		i++;
-		if (i > ctr_clex_bflmt) {
-			ctr_clex_emit_error( CTR_ERR_TOKBUFF );
+		if (c == '#' && ctr_code > ctr_clex_token_start) {
+			hash = ctr_code;
 		}
 		ctr_code++;
 		c = *ctr_code;
 	}
+	ctr_clex_tokval = ctr_clex_token_start;
+	ctr_clex_tokvlen = ctr_code - ctr_clex_token_start;
+	if (hash) {
+		/* a # within a reference drops everything between the first character and the # */
+		ctr_clex_tokval = ctr_heap_allocate_arena(ctr_code - hash);
+		ctr_clex_tokval[0] = *ctr_clex_token_start;
+		memcpy(ctr_clex_tokval + 1, hash + 1, ctr_code - hash - 1);
+		ctr_clex_tokvlen = ctr_code - hash;
+	}
 	return CTR_TOKEN_REF;
 }
 
@@ -356,145 +451,114 @@ char* ctr_clex_code_pointer() {
 }
 
 /**
- * CTRLexerStringReader
+ * CTRLexerStringScanner
  *
- * Reads an entire string between a pair of quotes.
+ * Scans a string up to the closing quote and returns the length of its
+ * value. If a buffer is given, the value is written to it. Sets decode
+ * if the value differs from the text in the program because of escape
+ * sequences or the ↵ and ⇿ symbols.
  */
-char* ctr_clex_readstr() {
+ctr_size ctr_clex_scanstr( char* buffer, int* decode ) {
 	ctr_size nesting = 0;
-	char* strbuff;
+	ctr_size length = 0;
+	ctr_size n;
+	char* value;
 	char c;
-	int escape;
-	char* beginbuff;
-	ctr_size page = 100; /* 100 byte pages */
-	ctr_size memblock = 100;
-	ctr_clex_tokvlen=0;
-	strbuff = (char*) ctr_heap_allocate(memblock);
-	beginbuff = strbuff;
-	escape = 0;
+	int escape = 0;
 	/* ignore_modes is used for translator, then you dont want to interpret escape sequence but copy -verbatim- */
 	while(
 		(ctr_code<ctr_eofcode-ctr_clex_keyword_qc_len) &&
-		(strncmp(ctr_code, CTR_DICT_QUOT_CLOSE, ctr_clex_keyword_qc_len)!=0 || nesting>0 || escape)
+		(!(ctr_clex_class[(uint8_t) *ctr_code] & CTR_CLEX_CLASS_STRING) || strncmp(ctr_code, CTR_DICT_QUOT_CLOSE, ctr_clex_keyword_qc_len)!=0 || nesting>0 || escape)
 	) {
 		c = *ctr_code;
-		if ( c == '\n' ) ctr_clex_line_number ++;
+		if ( c == '\n' ) {
+			ctr_clex_line_number ++;
+			ctr_clex_line_start = ctr_code + 1;
+		}
 		if ( c == '\\' && !escape) {
 			escape = 1;
+			*decode = 1;
 			if (ctr_clex_ignore_modes) {
-				*(strbuff) = '\\';
-				ctr_clex_tokvlen += 1;
-				strbuff++;
+				if (buffer) buffer[length] = '\\';
+				length++;
 			}
 			ctr_code ++;
 			continue;
 		}
+		value = ctr_code;
+		n = 1;
 		if ( escape == 1 ) {
 			switch(c) {
-				case 'n':
-					*(strbuff) = '\n';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 'r':
-					*(strbuff) = '\r';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 't':
-					*(strbuff) = '\t';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 'v':
-					*(strbuff) = '\v';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 'b':
-					*(strbuff) = '\b';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 'a':
-					*(strbuff) = '\a';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case 'f':
-					*(strbuff) = '\f';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				case '0':
-					*(strbuff) = '\0';
-					ctr_clex_tokvlen += 1;
-					strbuff++;
-					ctr_code++;
-					break;
-				default:
-					*(strbuff) = *(ctr_code);
-					strbuff++;
-					ctr_code++;
-					ctr_clex_tokvlen++;
-					break;
+				case 'n': value = "\n"; break;
+				case 'r': value = "\r"; break;
+				case 't': value = "\t"; break;
+				case 'v': value = "\v"; break;
+				case 'b': value = "\b"; break;
+				case 'a': value = "\a"; break;
+				case 'f': value = "\f"; break;
+				case '0': value = "\0"; break;
 			}
+			ctr_code++;
+		}
+		else if (!(ctr_clex_class[(uint8_t) c] & CTR_CLEX_CLASS_STRING)) {
+			ctr_code++;
 		}
-		else if (!ctr_clex_ignore_modes && !escape && strncmp(ctr_code, "↵", 3)==0) {
+		else if (!ctr_clex_ignore_modes && strncmp(ctr_code, "↵", 3)==0) {
+			value = "\n";
 			ctr_code += 3;
-			ctr_clex_tokvlen += 1;
-			*(strbuff) = '\n';
-			strbuff++;
+			*decode = 1;
 		}
-		else if (!ctr_clex_ignore_modes && !escape && strncmp(ctr_code, "⇿", 3)==0) {
+		else if (!ctr_clex_ignore_modes && strncmp(ctr_code, "⇿", 3)==0) {
+			value = "\t";
 			ctr_code += 3;
-			ctr_clex_tokvlen += 1;
-			*(strbuff) = '\t';
-			strbuff++;
+			*decode = 1;
 		}
 		else if (strncmp(ctr_code, CTR_DICT_QUOT_CLOSE, ctr_clex_keyword_qc_len)==0) {
-			if (!escape && !ctr_clex_ignore_modes) nesting--;
-			strncpy(strbuff, CTR_DICT_QUOT_CLOSE, ctr_clex_keyword_qc_len);
-			ctr_code += ctr_clex_keyword_qc_len;
-			ctr_clex_tokvlen += ctr_clex_keyword_qc_len;
-			strbuff += ctr_clex_keyword_qc_len;
+			if (!ctr_clex_ignore_modes) nesting--;
+			n = ctr_clex_keyword_qc_len;
+			ctr_code += n;
 		}
 		else if (strncmp(ctr_code, CTR_DICT_QUOT_OPEN, ctr_clex_keyword_qo_len)==0) {
-			if (!escape && !ctr_clex_ignore_modes) nesting++;
-			strncpy(strbuff, CTR_DICT_QUOT_OPEN, ctr_clex_keyword_qo_len);
-			ctr_code += ctr_clex_keyword_qo_len;
-			ctr_clex_tokvlen += ctr_clex_keyword_qo_len;
-			strbuff += ctr_clex_keyword_qo_len;
+			if (!ctr_clex_ignore_modes) nesting++;
+			n = ctr_clex_keyword_qo_len;
+			ctr_code += n;
 		} else {
-			*(strbuff) = *(ctr_code);
-			strbuff++;
 			ctr_code++;
-			ctr_clex_tokvlen++;
-		}
-		
-		if ((ctr_clex_tokvlen + 10) >= memblock) {
-			memblock += page;
-			beginbuff = (char*) ctr_heap_reallocate( beginbuff, memblock );
-			if (beginbuff == NULL) {
-				ctr_clex_emit_error( CTR_ERR_OOM );
-			}
-			/* reset pointer, memory location might have been changed */
-			strbuff = beginbuff + ctr_clex_tokvlen;
 		}
+		if (buffer) memcpy(buffer + length, value, n);
+		length += n;
 		escape = 0;
 	}
+	return length;
+}
+
+/**
+ * CTRLexerStringReader
+ *
+ * Reads an entire string between a pair of quotes and returns its value.
+ * The value is a slice of the program unless it contains escape sequences,
+ * then it is decoded into a copy in the arena. In both cases the value
+ * lives as long as the parsed program and must not be freed.
+ */
+char* ctr_clex_readstr() {
+	char* start = ctr_code;
+	char* line_start = ctr_clex_line_start;
+	int line_number = ctr_clex_line_number;
+	char* value = start;
+	int decode = 0;
+	ctr_clex_tokvlen = ctr_clex_scanstr( NULL, &decode );
+	if (decode) {
+		ctr_code = start;
+		ctr_clex_line_start = line_start;
+		ctr_clex_line_number = line_number;
+		value = ctr_heap_allocate_arena( ctr_clex_tokvlen + 1 );
+		ctr_clex_scanstr( value, &decode );
+	}
 	/* absorb trailing quote, unless eof encountered - then string ends at eof */
 	if (ctr_code<=ctr_eofcode-ctr_clex_keyword_qc_len) {
 		ctr_code += ctr_clex_keyword_qc_len;
 	}
-	return beginbuff;
+	return value;
 }
 
 void ctr_clex_set_ignore_modes( int ignore ) {
@@ -1,6 +1,7 @@
 #include "citrine.h"
 
 uint64_t ctr_gc_alloc;
+uint64_t ctr_gc_alloc_peak;
 uint64_t ctr_gc_memlimit;
 
 /**
@@ -18,9 +19,17 @@ memBlock*  memBlocks = NULL;
 size_t     numberOfMemBlocks = 0;
 size_t     maxNumberOfMemBlocks = 0;
 
+/**
+ * Arena, the tracked memory block consecutive arena allocations are
+ * taken from (see ctr_heap_allocate_arena).
+ */
+char*      ctr_heap_arena = NULL;
+size_t     ctr_heap_arena_id = 0;
+size_t     ctr_heap_arena_used = 0;
+size_t     ctr_heap_arena_size = 0;
+
 char* ctr_pool_alloc( ctr_size podSize );
 void ctr_pool_dealloc( void* ptr );
-void ctr_pool_init();
 int ctr_pool_bucket( ctr_size size );
 
 /**
@@ -54,6 +63,7 @@ void* ctr_heap_allocate( size_t size ) {
 	size = ctr_pool_bucket( size );
 	/* Check whether we can afford to allocate this much */
 	ctr_gc_alloc += size;
+	if (ctr_gc_alloc > ctr_gc_alloc_peak) ctr_gc_alloc_peak = ctr_gc_alloc;
 	if (ctr_gc_memlimit < ctr_gc_alloc) {
 		printf( CTR_MERR_OOM, (unsigned long) size );
 		exit(1);
@@ -88,6 +98,12 @@ size_t ctr_heap_tracker_memoryblocknumber() {
 size_t ctr_heap_tracker_rewind( size_t memoryBlockNumber ) {
 	size_t i;
 	i = 0;
+	ctr_program_cache_rewind( memoryBlockNumber );
+	ctr_profile_rewind();
+	ctr_utf8_drop( memoryBlockNumber, numberOfMemBlocks );
+	if ( ctr_heap_arena && ctr_heap_arena_id >= memoryBlockNumber ) {
+		ctr_heap_arena = NULL;
+	}
 	while ( numberOfMemBlocks > memoryBlockNumber) {
 		ctr_heap_free(memBlocks[ --numberOfMemBlocks ].space);
 		i ++;
@@ -95,19 +111,70 @@ size_t ctr_heap_tracker_rewind( size_t memoryBlockNumber ) {
 	return i;
 }
 
+/**
+ * Returns the number of bytes held by the memory blocks
+ * tracked since the specified memory block number.
+ */
+size_t ctr_heap_tracker_size( size_t memoryBlockNumber ) {
+	size_t i;
+	size_t size = 0;
+	for ( i = memoryBlockNumber; i < numberOfMemBlocks; i ++ ) {
+		size += memBlocks[ i ].size;
+	}
+	return size;
+}
+
+/**
+ * Frees the memory blocks tracked from the first position up to
+ * the last one (exclusive) without rewinding, the positions stay
+ * in use but no longer hold any memory.
+ */
+void ctr_heap_tracker_release( size_t from, size_t to ) {
+	size_t i;
+	if ( ctr_heap_arena && ctr_heap_arena_id >= from && ctr_heap_arena_id < to ) {
+		ctr_heap_arena = NULL;
+	}
+	ctr_utf8_drop( from, to );
+	for ( i = from; i < to && i < numberOfMemBlocks; i ++ ) {
+		ctr_heap_free( memBlocks[ i ].space );
+		memBlocks[ i ].space = NULL;
+		memBlocks[ i ].size = 0;
+	}
+}
+
+/**
+ * Returns 1 if the pointer points into one of the memory blocks
+ * tracked from the first position up to the last one (exclusive).
+ */
+int ctr_heap_tracker_owns( void* ptr, size_t from, size_t to ) {
+	size_t i;
+	char* space;
+	for ( i = from; i < to && i < numberOfMemBlocks; i ++ ) {
+		space = (char*) memBlocks[ i ].space;
+		if ( space && (char*) ptr >= space && (char*) ptr < space + memBlocks[ i ].size ) return 1;
+	}
+	return 0;
+}
+
 /**
  * Allocates memory on heap and tracks it for clean-up when
  * the program ends.
  */
 void* ctr_heap_allocate_tracked( size_t size ) {
-	void* space;
-	space = ctr_heap_allocate( size );
+	return ctr_heap_track( ctr_heap_allocate( size ), size );
+}
+
+/**
+ * Tracks memory that has been allocated on heap for clean-up when
+ * the program ends, from now on it is freed like tracked memory.
+ */
+void* ctr_heap_track( void* space, size_t size ) {
 	if ( numberOfMemBlocks >= maxNumberOfMemBlocks ) {
 		if ( memBlocks == NULL ) {
 			memBlocks = ctr_heap_allocate( sizeof( memBlock ) );
 			maxNumberOfMemBlocks = 1;
 		} else {
-			maxNumberOfMemBlocks += 10;
+			maxNumberOfMemBlocks *= 2;
 			memBlocks = ctr_heap_reallocate( memBlocks, ( sizeof( memBlock ) * ( maxNumberOfMemBlocks ) ) );
 		}
 	}
@@ -117,6 +184,45 @@ void* ctr_heap_allocate_tracked( size_t size ) {
 	return space;
 }
 
+/**
+ * Allocates tracked memory from an arena: consecutive allocations are
+ * placed next to each other in larger tracked blocks, which start at
+ * CTR_HEAP_ARENA_MIN bytes and double up to CTR_HEAP_ARENA_MAX bytes.
+ * Used by the parser, a program lives in a few blocks instead of
+ * one block per node. Arena memory cannot be freed or reallocated
+ * on its own, it is released along with the block it has been taken
+ * from, when the tracker rewinds or all tracked memory is freed.
+ */
+void* ctr_heap_allocate_arena( size_t size ) {
+	void* space;
+	size = ( size + 7 ) & ~( (size_t) 7 );
+	if ( size > CTR_HEAP_ARENA_MIN / 4 ) {
+		return ctr_heap_allocate_tracked( size );
+	}
+	if ( ctr_heap_arena == NULL || ctr_heap_arena_used + size > ctr_heap_arena_size ) {
+		if ( ctr_heap_arena == NULL ) {
+			ctr_heap_arena_size = CTR_HEAP_ARENA_MIN;
+		} else if ( ctr_heap_arena_size < CTR_HEAP_ARENA_MAX ) {
+			ctr_heap_arena_size *= 2;
+		}
+		ctr_heap_arena = ctr_heap_allocate_tracked( ctr_heap_arena_size );
+		ctr_heap_arena_id = ctr_heap_get_latest_tracking_id();
+		ctr_heap_arena_used = 0;
+	}
+	space = ctr_heap_arena + ctr_heap_arena_used;
+	ctr_heap_arena_used += size;
+	return space;
+}
+
+/**
+ * Closes the arena, the next arena allocation takes a new block.
+ * Keeps the blocks of a parsed program apart from whatever has been
+ * allocated before or will be allocated after it.
+ */
+void ctr_heap_arena_close() {
+	ctr_heap_arena = NULL;
+}
+
 /**
  * Reallocates tracked memory on heap.
  * You need to provide a tracking ID.
@@ -142,6 +248,8 @@ size_t ctr_heap_get_latest_tracking_id() {
  */
 void ctr_heap_free_rest() {
 	size_t i;
+	ctr_program_cache_rewind( 0 );
+	ctr_utf8_drop( 0, numberOfMemBlocks );
 	for ( i = 0; i < numberOfMemBlocks; i ++) {
 		ctr_heap_free( memBlocks[i].space );
 	}
@@ -149,6 +257,11 @@ void ctr_heap_free_rest() {
 	memBlocks = NULL;
 	numberOfMemBlocks = 0;
 	maxNumberOfMemBlocks = 0;
+	ctr_heap_arena = NULL;
+	/* release the slabs unless blocks are still in use (leak report) */
+	if ( ctr_gc_alloc == 0 ) {
+		ctr_pool_init( 0 );
+	}
 }
 
 
@@ -174,7 +287,8 @@ void ctr_heap_free( void* ptr ) {
 	block_width = (size_t*) ptr;
 	size = *(block_width);
 	if (ctr_gc_clean_free) {
-		memset(ptr,0,size);
+		/* keep the size header, the pool needs it to find the size class */
+		memset((char*) ptr + q, 0, size - q);
 	}
 	ctr_pool_dealloc( ptr );
 	if (size > ctr_gc_alloc) {
@@ -219,6 +333,7 @@ void* ctr_heap_reallocate(void* oldptr, size_t size ) {
 
 	/* update the ledger */
 	ctr_gc_alloc = ( ctr_gc_alloc - old_size ) + size;
+	if (ctr_gc_alloc > ctr_gc_alloc_peak) ctr_gc_alloc_peak = ctr_gc_alloc;
 
 	/* re-allocate memory */
 	nptr = ctr_pool_alloc( size );
@@ -280,24 +395,103 @@ char* ctr_heap_allocate_cstring( ctr_object* stringObject ) {
 	return cstring;
 }
 
-// Pools are no longer used
-int usePools = 0;
+/**
+ * Size-class slab allocator.
+ *
+ * Small blocks (the hot structures: objects, maps, map items,
+ * arguments and AST nodes, including their size header) are
+ * rounded up to a size class and carved from slabs. Freed blocks
+ * go to the free list of their class and are handed out again by
+ * the next allocation of that class. Larger blocks are passed on
+ * to calloc/free. Only the blocks handed out count as allocated
+ * memory (ctr_gc_alloc), not the slabs themselves.
+ */
+ctr_pool_class ctr_pools[CTR_POOL_CLASSES];
+ctr_size ctr_pool_slab_size = CTR_POOL_SLAB_SIZE;
+char* ctr_pool_slabs = NULL;
 
+/**
+ * Initializes the pools, releasing the slabs of earlier runs.
+ * The argument specifies the slab size in bytes, 0 for default.
+ */
 void ctr_pool_init( ctr_size pool ) {
-	return; //no longer used
+	char* slab;
+	while ( ctr_pool_slabs ) {
+		slab = ctr_pool_slabs;
+		ctr_pool_slabs = *( (char**) slab );
+		free( slab );
+	}
+	memset( ctr_pools, 0, sizeof( ctr_pools ) );
+	ctr_pool_slab_size = ( pool ) ? pool : CTR_POOL_SLAB_SIZE;
 }
 
+/**
+ * Returns the size class of a block of the specified size,
+ * -1 if the block is too large to be pooled.
+ */
+int ctr_pool_class_of( ctr_size size ) {
+	if ( size > CTR_POOL_CLASSES * CTR_POOL_CLASS_WIDTH ) return -1;
+	return ( size - 1 ) / CTR_POOL_CLASS_WIDTH;
+}
+
+/**
+ * Rounds the size of a block up to its size class.
+ */
 int ctr_pool_bucket( ctr_size size ) {
-	return size;
+	int c = ctr_pool_class_of( size );
+	if ( c < 0 ) return size;
+	return ( c + 1 ) * CTR_POOL_CLASS_WIDTH;
 }
 
+/**
+ * Allocates a zeroed block, the size has already been bucketed.
+ */
 char* ctr_pool_alloc( ctr_size podSize ) {
-	return (char*) calloc(podSize, 1);
+	ctr_pool_class* pool;
+	char* block;
+	char* slab;
+	int c = ctr_pool_class_of( podSize );
+	if ( c < 0 ) return (char*) calloc( podSize, 1 );
+	pool = &ctr_pools[c];
+	if ( pool->free ) {
+		block = pool->free;
+		pool->free = *( (char**) block );
+		pool->available--;
+		memset( block, 0, podSize );
+	} else {
+		if ( pool->cursor + podSize > pool->end ) {
+			slab = calloc( ctr_pool_slab_size, 1 );
+			if ( slab == NULL ) return NULL;
+			/* the first block of every slab links the slabs together */
+			*( (char**) slab ) = ctr_pool_slabs;
+			ctr_pool_slabs = slab;
+			pool->cursor = slab + CTR_POOL_CLASS_WIDTH;
+			pool->end = slab + ctr_pool_slab_size;
+			pool->slabs++;
+		}
+		block = pool->cursor;
+		pool->cursor += podSize;
+	}
+	pool->used++;
+	return block;
 }
 
+/**
+ * Returns a block to the free list of its size class,
+ * the size header in front of the block tells which one.
+ */
 void ctr_pool_dealloc( void* ptr ) {
+	ctr_pool_class* pool;
+	int c;
 	if (ptr == NULL) return;
-	free(ptr);
-	return;
+	c = ctr_pool_class_of( *( (size_t*) ptr ) );
+	if ( c < 0 ) {
+		free(ptr);
+		return;
+	}
+	pool = &ctr_pools[c];
+	*( (char**) ptr ) = pool->free;
+	pool->free = ptr;
+	pool->used--;
+	pool->available++;
 }
-
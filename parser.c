@@ -8,7 +8,6 @@
 #include "citrine.h"
 
 char* ctr_cparse_current_program;
-ctr_source_map* ctr_source_map_head;
 int ctr_source_mapping;
 
 /**
@@ -41,24 +40,31 @@ void ctr_cparse_emit_error_unexpected( int t, char* hint )
 /**
  * CTRParserCreateNode
  *
- * Creates a parser node and adds it to the source map.
+ * Creates a parser node and records its position in the source.
+ * Nodes, like everything else the parser allocates, are taken from
+ * the arena so a program is laid out in a few contiguous blocks.
  */
 ctr_tnode* ctr_cparse_create_node( int type ){
-	ctr_tnode* node = (ctr_tnode*) ctr_heap_allocate_tracked( sizeof( ctr_tnode ) );
+	ctr_tnode* node = (ctr_tnode*) ctr_heap_allocate_arena( sizeof( ctr_tnode ) );
 	if (ctr_source_mapping) {
-		ctr_source_map* m = (ctr_source_map*) ctr_heap_allocate_tracked( sizeof( ctr_source_map ) );
-		m->line = ctr_clex_line_number;
-		m->node = node;
-		if (ctr_source_map_head) {
-			m->next = ctr_source_map_head;
-			ctr_source_map_head = m;
-		} else {
-			ctr_source_map_head = m;
-		}
+		node->line = ctr_clex_line_number + 1;
+		node->column = ctr_clex_column();
+		node->program = ctr_cparse_current_program;
 	}
 	return node;
 }
 
+/**
+ * CTRParserMessageSelector
+ *
+ * Stores the selector of a message node.
+ */
+void ctr_cparse_message_selector(ctr_tnode* m, char* msg, ctr_size msgpartlen) {
+	m->value = msg;
+	m->vlen = msgpartlen;
+	m->symbol = ctr_symbol_intern(m->value, msgpartlen);
+}
+
 /**
  * CTRParserMessage
  *
@@ -73,7 +79,7 @@ ctr_tnode* ctr_cparse_message(int mode) {
 	ctr_tnode* m;
 	int t;
 	char* s;
-	char* msg;
+	char msg[256]; /* selector being assembled, copied to the arena once complete */
 	ctr_tlistitem* li;
 	ctr_tlistitem* curlistitem;
 	int lookAhead;
@@ -88,8 +94,8 @@ ctr_tnode* ctr_cparse_message(int mode) {
 	}
 	m = ctr_cparse_create_node( CTR_AST_NODE );
 	m->type = -1;
+	m->cache = (ctr_inline_cache*) ctr_heap_allocate_arena( sizeof( ctr_inline_cache ) );
 	s = ctr_clex_tok_value();
-	msg = ctr_heap_allocate_tracked( 255 * sizeof( char ) );
 	memcpy(msg, s, msgpartlen);
 	ulen = ctr_getutf8len(msg, msgpartlen);
 	lookAhead = ctr_clex_tok(); ctr_clex_putback();
@@ -100,9 +106,8 @@ ctr_tnode* ctr_cparse_message(int mode) {
 	}
 	if (isBin) {
 		m->type = CTR_AST_NODE_BINMESSAGE;
-		m->value = msg;
-		m->vlen = msgpartlen;
-		li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+		ctr_cparse_message_selector(m, s, msgpartlen);
+		li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 		li->node = ctr_cparse_expr(2);
 		if (li->node == NULL) return NULL;
 		m->nodes = li;
@@ -123,7 +128,7 @@ ctr_tnode* ctr_cparse_message(int mode) {
 		t = ctr_clex_tok();
 		first = 1;
 		while(1) {
-			li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+			li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 			li->node = ctr_cparse_expr(1);
 			if (li->node == NULL) {
 				return NULL;
@@ -158,13 +163,13 @@ ctr_tnode* ctr_cparse_message(int mode) {
 			}
 		}
 		ctr_clex_putback(); /* not a colon so put back */
-		m->value = msg;
-		m->vlen = msgpartlen;
+		/* the selector is assembled from several tokens */
+		s = ctr_heap_allocate_arena( msgpartlen );
+		memcpy(s, msg, msgpartlen);
 	} else {
 		m->type = CTR_AST_NODE_UNAMESSAGE;
-		m->value = msg;
-		m->vlen = msgpartlen;
 	}
+	ctr_cparse_message_selector(m, s, msgpartlen);
 	return m;
 }
 
@@ -190,7 +195,7 @@ ctr_tlistitem* ctr_cparse_messages(ctr_tnode* r, int mode) {
 				return NULL;
 			}
 		}
-		li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+		li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 		ctr_clex_putback();
 		node = ctr_cparse_message(mode);
 		if (node == NULL) return NULL;
@@ -234,7 +239,7 @@ ctr_tnode* ctr_cparse_popen() {
 	ctr_clex_tok();
 	r = ctr_cparse_create_node( CTR_AST_NODE );
 	r->type = CTR_AST_NODE_NESTED;
-	li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+	li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 	r->nodes = li;
 	li->node = ctr_cparse_expr(0);
 	if (li->node == NULL) return NULL;
@@ -264,8 +269,8 @@ ctr_tnode* ctr_cparse_block() {
 	ctr_clex_tok();
 	r = ctr_cparse_create_node( CTR_AST_NODE );
 	r->type = CTR_AST_NODE_CODEBLOCK;
-	codeBlockPart1 = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
-	codeBlockPart2 = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+	codeBlockPart1 = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
+	codeBlockPart2 = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 	r->nodes = codeBlockPart1;
 	paramList = ctr_cparse_create_node( CTR_AST_NODE );
 	codeList  = ctr_cparse_create_node( CTR_AST_NODE );
@@ -291,13 +296,13 @@ ctr_tnode* ctr_cparse_block() {
 	while(t == CTR_TOKEN_COLON) {
 		/* okay we have new parameter, load it */
 		t = ctr_clex_tok();
-		ctr_tlistitem* paramListItem = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+		ctr_tlistitem* paramListItem = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 		ctr_tnode* paramItem = ctr_cparse_create_node( CTR_AST_NODE );
 		long l = ctr_clex_tok_value_length();
 		paramItem->type = CTR_AST_NODE_PARAMETER;
-		paramItem->value = ctr_heap_allocate_tracked( sizeof( char ) * l );
-		memcpy(paramItem->value, ctr_clex_tok_value(), l);
+		paramItem->value = ctr_clex_tok_value();
 		paramItem->vlen = l;
+		paramItem->symbol = ctr_symbol_intern(paramItem->value, l);
 		paramListItem->node = paramItem;
 		if (first) {
 			paramList->nodes = paramListItem;
@@ -323,7 +328,7 @@ ctr_tnode* ctr_cparse_block() {
 		t = ctr_clex_tok();
 		if (t == CTR_TOKEN_BLOCKCLOSE) break;
 		ctr_clex_putback();
-		codeListItem = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+		codeListItem = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 		codeNode = ctr_cparse_create_node( CTR_AST_NODE );
 		if (t == CTR_TOKEN_RET) {
 			codeNode = ctr_cparse_ret();
@@ -385,8 +390,8 @@ ctr_tnode* ctr_cparse_ref() {
 		r->modifier = 2;
 		r->vlen = ctr_clex_tok_value_length();
 	}
-	r->value = ctr_heap_allocate_tracked( r->vlen );
-	memcpy(r->value, tmp, r->vlen);
+	r->value = tmp;
+	r->symbol = ctr_symbol_intern(r->value, r->vlen);
 	return r;
 }
 
@@ -404,10 +409,11 @@ ctr_tnode* ctr_cparse_string() {
 	r->type = CTR_AST_NODE_LTRSTRING;
 	n = ctr_clex_readstr();
 	vlen = ctr_clex_tok_value_length();
-	r->value = ctr_heap_allocate_tracked( sizeof( char ) * vlen );
-	memcpy(r->value, n, vlen);
+	r->value = n;
 	r->vlen = vlen;
-	ctr_heap_free(n);
+	r->constant = ctr_internal_create_constant( CTR_OBJECT_TYPE_OTSTRING );
+	r->constant->value.svalue->value = r->value;
+	r->constant->value.svalue->vlen = vlen;
 	return r;
 }
 
@@ -420,14 +426,19 @@ ctr_tnode* ctr_cparse_number() {
 	char* n;
 	ctr_tnode* r;
 	long l;
+	char buffer[41];
 	ctr_clex_tok();
 	r = ctr_cparse_create_node( CTR_AST_NODE );
 	r->type = CTR_AST_NODE_LTRNUM;
 	n = ctr_clex_tok_value();
 	l = ctr_clex_tok_value_length();
-	r->value = ctr_heap_allocate_tracked( sizeof( char ) * l );
-	memcpy(r->value, n, l);
+	r->value = n;
 	r->vlen = l;
+	/* converted once, exactly like ctr_build_number_from_string would */
+	memset(buffer, 0, 41);
+	memcpy(buffer, n, ( l <= 40 ) ? l : 40);
+	r->constant = ctr_internal_create_constant( CTR_OBJECT_TYPE_OTNUMBER );
+	r->constant->value.nvalue = atof(buffer);
 	return r;
 }
 
@@ -469,8 +480,8 @@ ctr_tnode* ctr_cparse_assignment(ctr_tnode* r) {
 	ctr_tlistitem* liAssignExpr;
 	ctr_clex_tok();
 	a = ctr_cparse_create_node( CTR_AST_NODE );
-	li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
-	liAssignExpr = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+	li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
+	liAssignExpr = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 	a->type = CTR_AST_NODE_EXPRASSIGNMENT;
 	a->nodes = li;
 	li->node = r;
@@ -534,7 +545,7 @@ ctr_tnode* ctr_cparse_expr(int mode) {
 			ctr_clex_putback();
 			return r; /* no messages, then just return receiver (might be in case of argument). */
 		}
-		rli = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+		rli = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 		rli->node = r;
 		rli->next = nodes;
 		e->nodes = rli;
@@ -555,7 +566,7 @@ ctr_tnode* ctr_cparse_ret() {
 	ctr_clex_tok();
 	r = ctr_cparse_create_node( CTR_AST_NODE );
 	r->type = CTR_AST_NODE_RETURNFROMBLOCK;
-	li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+	li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 	r->nodes = li;
 	li->node = ctr_cparse_expr(0);
 	if (li->node == NULL) return NULL;
@@ -581,7 +592,7 @@ ctr_tnode* ctr_cparse_fin() {
  * Generates a set of nodes representing a statement.
  */
 ctr_tlistitem* ctr_cparse_statement() {
-	ctr_tlistitem* li = (ctr_tlistitem*) ctr_heap_allocate_tracked( sizeof(ctr_tlistitem) );
+	ctr_tlistitem* li = (ctr_tlistitem*) ctr_heap_allocate_arena( sizeof(ctr_tlistitem) );
 	int t = ctr_clex_tok();
 	ctr_clex_putback();
 	if (t == CTR_TOKEN_FIN) {
@@ -629,10 +640,102 @@ ctr_tnode* ctr_cparse_program() {
 	return program;
 }
 
+/**
+ * CTRParserScopeDeclare
+ *
+ * Adds the variables declared with >> in the nodes to the scope,
+ * nested blocks are skipped, they have scopes of their own.
+ */
+void ctr_cparse_scope_declare(ctr_tnode* node, ctr_scope* scope, ctr_size* capacity) {
+	ctr_tlistitem* li;
+	ctr_tnode* child;
+	for(li = node->nodes; li; li = li->next) {
+		child = li->node;
+		if (child == NULL || child->type == CTR_AST_NODE_CODEBLOCK) continue;
+		if (child->type == CTR_AST_NODE_REFERENCE && child->modifier == 2 && ctr_scope_find(scope, child->symbol) < 0) {
+			if (scope->count == *capacity) {
+				*capacity *= 2;
+				scope->names = ctr_heap_reallocate(scope->names, *capacity * sizeof(ctr_object*));
+			}
+			scope->names[scope->count++] = child->symbol;
+		}
+		ctr_cparse_scope_declare(child, scope, capacity);
+	}
+}
+
+/**
+ * CTRParserScope
+ *
+ * Gives the references in the nodes to variables of the scope their
+ * slots and determines the scopes of nested blocks. The program itself
+ * has no scope (NULL), its variables live in the World.
+ */
+void ctr_cparse_scope(ctr_tnode* node, ctr_scope* scope) {
+	ctr_tlistitem* li;
+	ctr_tnode* child;
+	int slot;
+	for(li = node->nodes; li; li = li->next) {
+		child = li->node;
+		if (child == NULL) continue;
+		if (child->type == CTR_AST_NODE_CODEBLOCK) {
+			child->scope = ctr_cparse_scope_block(child);
+			continue;
+		}
+		if (scope && child->type == CTR_AST_NODE_REFERENCE && child->modifier != 1) {
+			slot = ctr_scope_find(scope, child->symbol);
+			if (slot >= 0) {
+				child->scope = scope;
+				child->slot = slot + 1;
+			}
+		}
+		ctr_cparse_scope(child, scope);
+	}
+}
+
+/**
+ * CTRParserScopeBlock
+ *
+ * Determines the scope of a block: me, my, the current task, the
+ * parameters and the variables declared in the block.
+ */
+ctr_scope* ctr_cparse_scope_block(ctr_tnode* block) {
+	ctr_scope* scope;
+	ctr_scope names;
+	ctr_size capacity = 8;
+	ctr_tnode* paramList = block->nodes->node;
+	ctr_tnode* codeList = block->nodes->next->node;
+	ctr_tlistitem* li;
+	names.count = 0;
+	names.names = ctr_heap_allocate(capacity * sizeof(ctr_object*));
+	names.names[CTR_SLOT_ME] = CtrSymbolMe;
+	names.names[CTR_SLOT_MY] = CtrSymbolMy;
+	names.names[CTR_SLOT_TASK] = CtrSymbolCurrentTask;
+	names.count = 3;
+	for(li = paramList->nodes; li; li = li->next) {
+		if (ctr_scope_find(&names, li->node->symbol) < 0) {
+			if (names.count == capacity) {
+				capacity *= 2;
+				names.names = ctr_heap_reallocate(names.names, capacity * sizeof(ctr_object*));
+			}
+			names.names[names.count++] = li->node->symbol;
+		}
+		li->node->slot = ctr_scope_find(&names, li->node->symbol) + 1;
+	}
+	ctr_cparse_scope_declare(codeList, &names, &capacity);
+	scope = ctr_heap_allocate_arena(sizeof(ctr_scope));
+	scope->count = names.count;
+	scope->names = ctr_heap_allocate_arena(names.count * sizeof(ctr_object*));
+	memcpy(scope->names, names.names, names.count * sizeof(ctr_object*));
+	ctr_heap_free(names.names);
+	ctr_cparse_scope(codeList, scope);
+	return scope;
+}
+
 /**
  * CTRParserStart
  *
- * Begins the parsing stage of a program.
+ * Begins the parsing stage of a program. The nodes refer to the
+ * program text, it has to be kept as long as the parsed program.
  */
 ctr_tnode*  ctr_cparse_parse(char* prg, char* pathString) {
 	ctr_tnode* program;
@@ -645,5 +748,10 @@ ctr_tnode*  ctr_cparse_parse(char* prg, char* pathString) {
 	program->value = pathString;
 	program->vlen = strlen(pathString);
 	program->type = CTR_AST_NODE_PROGRAM;
+	if (CtrSymbolMe == NULL) ctr_internal_symbols_initialize();
+	ctr_cparse_scope(program, NULL);
+	if (ctr_vm_mode) {
+		ctr_vm_compile_program(program);
+	}
 	return program;
 }
@@ -367,7 +367,7 @@ ctr_object* ctr_json_jsonify(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_mapitem* mapItem;
 	ctr_argument* newArgumentList;
 	string  = ctr_build_string_from_cstring( "{" );
-	mapItem = argumentList->object->properties->head;
+	mapItem = argumentList->object->properties ? argumentList->object->properties->head : NULL;
 	newArgumentList = ctr_heap_allocate( sizeof( ctr_argument ) );
 	while( mapItem ) {
 		if ( mapItem->key->info.type == CTR_OBJECT_TYPE_OTBOOL && mapItem->key->value.bvalue == 1) {
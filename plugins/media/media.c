@@ -550,7 +550,7 @@ ctr_object* ctr_json_jsonify(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_mapitem* mapItem;
 	ctr_argument* newArgumentList;
 	string  = ctr_build_string_from_cstring( "{" );
-	mapItem = argumentList->object->properties->head;
+	mapItem = argumentList->object->properties ? argumentList->object->properties->head : NULL;
 	newArgumentList = ctr_heap_allocate( sizeof( ctr_argument ) );
 	while( mapItem ) {
 		if ( mapItem->key->info.type == CTR_OBJECT_TYPE_OTBOOL && mapItem->key->value.bvalue == 1) {
@@ -1884,6 +1884,8 @@ ctr_object* ctr_media_screen(ctr_object* myself, ctr_argument* argumentList) {
 	dir = -1;
 	c4speed = 0;
 	CtrMediaScreenActive = 1;
+	// unless a mode was chosen, collect incrementally, a major collection must not stall a frame
+	if (!ctr_gc_mode_chosen) ctr_gc_mode |= 8;
 	CtrMediaTicks1 = SDL_GetTicks64(); //reset ticks, otherwise a dialog at the begin will cause motions to be far 'further'
 	while (!CtrStdFlow) {
 		if (CtrMediaFlagSoftwareVSync) {
@@ -4869,33 +4871,40 @@ ctr_object* ctr_media_console_brk(ctr_object* myself, ctr_argument* argumentList
 
 ctr_object* ctr_media_include(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* pathStrObj = ctr_internal_cast2string(argumentList->object);
-	char* pathString = ctr_heap_allocate_tracked(pathStrObj->value.svalue->vlen + 1);
+	char* pathString = ctr_heap_allocate(pathStrObj->value.svalue->vlen + 1);
 	strncpy(pathString, pathStrObj->value.svalue->value, pathStrObj->value.svalue->vlen);
 	pathString[pathStrObj->value.svalue->vlen] = '\0';
-	SDL_RWops* asset_reader = ctr_internal_media_load_asset(pathString, 1);
-	if (!asset_reader) {
-		ctr_error("Unable to open code asset.", 0);
-		return CtrStdNil;
+	ctr_tnode* parsedCode = ctr_program_cache_get(pathString);
+	ctr_heap_free(pathString);
+	if (parsedCode == NULL) {
+		size_t memblock = ctr_heap_tracker_memoryblocknumber();
+		pathString = ctr_heap_allocate_tracked(pathStrObj->value.svalue->vlen + 1);
+		strncpy(pathString, pathStrObj->value.svalue->value, pathStrObj->value.svalue->vlen);
+		pathString[pathStrObj->value.svalue->vlen] = '\0';
+		SDL_RWops* asset_reader = ctr_internal_media_load_asset(pathString, 1);
+		if (!asset_reader) {
+			ctr_error("Unable to open code asset.", 0);
+			return CtrStdNil;
+		}
+		char* prg;
+		int chunk = 512;
+		size_t bytes_read;
+		size_t offset = 0;
+		prg = ctr_heap_allocate(chunk + 1);
+		bytes_read = SDL_RWread(asset_reader, prg, 1, chunk);
+		offset += bytes_read;
+		while (bytes_read > 0) {
+			prg = ctr_heap_reallocate(prg, offset + chunk + 1);
+			bytes_read = SDL_RWread(asset_reader, prg + offset, 1, chunk);
+			offset += bytes_read;
+		}
+		SDL_RWclose(asset_reader);
+		prg[offset] = '\0';
+		ctr_program_length = offset;
+		ctr_heap_track(prg, offset + chunk + 1); /* kept along with the parsed code, nodes refer to it */
+		parsedCode = ctr_cparse_parse(prg, pathString);
+		if (parsedCode) ctr_program_cache_put(pathString, parsedCode, memblock);
 	}
-	char* prg;
-	int prg_id;
-	int chunk = 512;
-	size_t bytes_read;
-	size_t offset = 0;
-	ctr_tnode* parsedCode;
-	prg = ctr_heap_allocate_tracked(chunk);
-	prg_id = ctr_heap_get_latest_tracking_id();
-	bytes_read = SDL_RWread(asset_reader, prg, 1, chunk);
-	offset += bytes_read;
-	while (bytes_read > 0) {
-		prg = ctr_heap_reallocate_tracked(prg_id, offset + chunk + 1);
-		bytes_read = SDL_RWread(asset_reader, prg + offset, 1, chunk);
-        offset += bytes_read;
-    }
-    SDL_RWclose(asset_reader);
-    prg[offset + 1] = '\0';
-    ctr_program_length = offset;
-	parsedCode = ctr_cparse_parse(prg, pathString);
 	if (parsedCode) {
 		ctr_cwlk_subprogram++;
 		ctr_cwlk_run(parsedCode);
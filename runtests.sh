@@ -48,16 +48,17 @@ unittest() {
 	i=$1
 	mmode=$2
 	os=$3
+	switch=$4
 	CITRINE_MEMORY_MODE=$mmode
 	export CITRINE_MEMORY_MODE
 
 	if [[ $os = "lin" ]]; then
-		echo "test"  | ./bin/Linux/ctren tests/en/t-$i.ctr 1>/tmp/rs 2>/tmp/err
+		echo "test"  | ./bin/Linux/ctren $switch tests/en/t-$i.ctr 1>/tmp/rs 2>/tmp/err
 		cat /tmp/rs /tmp/err > /tmp/out
 	fi
 
 	if [[ $os = "win" ]]; then
-		echo "test"  | wine ./bin/Win64/ctren.exe tests/en/t-$i.ctr 1>/tmp/rs 2>/tmp/err
+		echo "test"  | wine ./bin/Win64/ctren.exe $switch tests/en/t-$i.ctr 1>/tmp/rs 2>/tmp/err
 		cat /tmp/rs /tmp/err > /tmp/out
 	fi
 
@@ -107,22 +108,27 @@ unittest() {
 			exit 1
 		fi
 	else
-		echo "✓ test $i | $mmode"
+		echo "✓ test $i | $mmode $switch"
 	fi
 
 }
 
 # select range
 FROM=1
-TIL=643
+TIL=656
 
 # run tests for linux
 buildlin
 for i in $(seq -f "%04g" $FROM $TIL);
 do
     unittest $i 1 lin
+    unittest $i 2 lin
     unittest $i 4 lin
     unittest $i 0 lin
+    unittest $i 1 lin -b
+    unittest $i 2 lin -b
+    unittest $i 4 lin -b
+    unittest $i 0 lin -b
 done
 
 if [[ $CI == "full" ]]; then
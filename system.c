@@ -5,130 +5,403 @@ int ctr_gc_object_counter;
 int ctr_gc_kept_counter;
 int ctr_gc_sticky_counter;
 int ctr_gc_mode;
+int ctr_gc_mode_chosen = 0; /* set once the program or environment selects a mode */
 
 double CtrVersionTime = 1753777732; // 29 july 2025
 
 /**
  * @internal
- * GarbageCollector Marker
+ * Generational bookkeeping.
+ * New objects are born in the young generation (ctr_first_young),
+ * a minor collection only sweeps this list and promotes the survivors
+ * to the old generation (ctr_first_object). Old objects that receive
+ * a reference to a young one are kept in the remembered set, they
+ * act as additional roots during a minor collection.
  */
-void ctr_gc_mark(ctr_object* object) {
-	ctr_object* el;
+int ctr_gc_minor = 0;
+int ctr_gc_young_counter = 0;
+int ctr_gc_minor_counter = 0;
+int ctr_gc_major_counter = 0;
+double ctr_gc_minor_pause = 0;
+double ctr_gc_major_pause = 0;
+ctr_object** ctr_gc_remembered = NULL;
+ctr_size ctr_gc_remembered_count = 0;
+ctr_size ctr_gc_remembered_capacity = 0;
+
+/**
+ * @internal
+ * GarbageCollector Mark Stack
+ * Marking does not recurse, reachable objects are marked and pushed
+ * on this stack of gray objects (marked but not yet scanned) and
+ * scanned one by one, so deeply nested structures cannot exhaust
+ * the C stack. The stack grows up to CTR_GC_MARK_STACK_LIMIT entries,
+ * once it is full, objects are still marked but no longer pushed,
+ * instead the overflow flag is raised and the marked objects of the
+ * heap are scanned again afterwards. The stack is not allocated
+ * from the heap of the program because the collector has to work
+ * when that heap is about to run out, if it cannot grow, this is
+ * treated as an overflow as well.
+ */
+ctr_object** ctr_gc_gray_stack = NULL;
+ctr_size ctr_gc_gray_count = 0;
+ctr_size ctr_gc_gray_capacity = 0;
+int ctr_gc_gray_overflow = 0;
+
+/**
+ * @internal
+ * Is 1 while an incremental major collection is marking objects.
+ */
+int ctr_gc_marking = 0;
+
+/**
+ * @internal
+ * GarbageCollector Gray
+ * Marks an object and pushes it on the mark stack.
+ * During a minor collection old objects are considered marked,
+ * their references to young objects are found through the
+ * remembered set.
+ */
+void ctr_gc_gray(ctr_object* object) {
+	ctr_object** stack;
+	ctr_size capacity;
+	/* constants are never swept */
+	if (object->info.mark || object->info.constant || (ctr_gc_minor && object->info.old)) return;
+	object->info.mark = 1;
+	if (ctr_gc_gray_count == ctr_gc_gray_capacity) {
+		capacity = ctr_gc_gray_capacity ? ctr_gc_gray_capacity * 2 : 256;
+		if (capacity > CTR_GC_MARK_STACK_LIMIT) capacity = CTR_GC_MARK_STACK_LIMIT;
+		stack = NULL;
+		if (capacity > ctr_gc_gray_capacity) stack = realloc(ctr_gc_gray_stack, capacity * sizeof(ctr_object*));
+		if (stack == NULL) {
+			ctr_gc_gray_overflow = 1;
+			return;
+		}
+		ctr_gc_gray_stack = stack;
+		ctr_gc_gray_capacity = capacity;
+	}
+	ctr_gc_gray_stack[ctr_gc_gray_count++] = object;
+}
+
+/**
+ * @internal
+ * GarbageCollector Scanner
+ * Grays the objects referenced by an object: its elements,
+ * its properties and its methods (keys as well as values).
+ */
+void ctr_gc_scan(ctr_object* object) {
 	ctr_mapitem* item;
-	ctr_object* o;
-	ctr_object* k;
 	ctr_size i;
 	if (object->info.type == CTR_OBJECT_TYPE_OTARRAY) {
 		for (i = 0; i < object->value.avalue->head; i++) {
-			el = *(object->value.avalue->elements+i);
-			if (!el->info.mark) {
-				el->info.mark = 1;
-				ctr_gc_mark(el);
-			}
+			ctr_gc_gray(*(object->value.avalue->elements+i));
 		}
 	}
-	item = object->properties->head;
+	item = object->properties ? object->properties->head : NULL;
 	while(item) {
-		k = item->key;
-		o = item->value;
-		k->info.mark = 1;
-		if (!o->info.mark) {
-			o->info.mark = 1;
-			ctr_gc_mark(o);
-		}
+		ctr_gc_gray(item->key);
+		ctr_gc_gray(item->value);
 		item = item->next;
-	} 
-	item = object->methods->head;
+	}
+	item = object->methods ? object->methods->head : NULL;
 	while(item) {
-		o = item->value;
-		k = item->key;
-		k->info.mark = 1;
-		if (!o->info.mark) {
-			o->info.mark = 1;
-			ctr_gc_mark(o);
-		}
+		ctr_gc_gray(item->key);
+		ctr_gc_gray(item->value);
 		item = item->next;
-	} 
+	}
+}
+
+/**
+ * @internal
+ * Scans the marked objects in a list of objects again,
+ * to recover from a mark stack overflow.
+ */
+void ctr_gc_rescan(ctr_object* o) {
+	while(o) {
+		if (o->info.mark) {
+			ctr_gc_scan(o);
+			while(ctr_gc_gray_count) ctr_gc_scan(ctr_gc_gray_stack[--ctr_gc_gray_count]);
+		}
+		o = o->gnext;
+	}
+}
+
+/**
+ * @internal
+ * GarbageCollector Drain
+ * Scans the objects on the mark stack until it is empty or,
+ * if budget is not 0, until budget objects have been scanned.
+ * Returns 1 if marking is complete. Recovering from an overflow
+ * is not part of the budget, it is rare and cannot be split.
+ */
+int ctr_gc_drain(ctr_size budget) {
+	ctr_size scanned = 0;
+	while(ctr_gc_gray_count) {
+		if (budget && scanned == budget) return 0;
+		ctr_gc_scan(ctr_gc_gray_stack[--ctr_gc_gray_count]);
+		scanned++;
+	}
+	while(ctr_gc_gray_overflow) {
+		ctr_gc_gray_overflow = 0;
+		ctr_gc_rescan(ctr_first_young);
+		if (!ctr_gc_minor) ctr_gc_rescan(ctr_first_object);
+	}
+	return 1;
+}
+
+/**
+ * @internal
+ * Releases the mark stack after marking, like the remembered set
+ * it is allocated again when needed.
+ */
+void ctr_gc_drop_gray() {
+	if (ctr_gc_gray_stack) free(ctr_gc_gray_stack);
+	ctr_gc_gray_stack = NULL;
+	ctr_gc_gray_count = 0;
+	ctr_gc_gray_capacity = 0;
+	ctr_gc_gray_overflow = 0;
+}
+
+/**
+ * @internal
+ * GarbageCollector Marker
+ * Marks all objects reachable from the specified object.
+ */
+void ctr_gc_mark(ctr_object* object) {
+	ctr_gc_scan(object);
+	ctr_gc_drain(0);
+}
+
+/**
+ * @internal
+ * GarbageCollector Write Barrier
+ * Records an old object that receives a reference to a young one,
+ * to be called whenever a reference is stored in an object
+ * (properties, methods and collection elements).
+ * While an incremental collection is marking, a reference stored
+ * in an object that has already been marked is grayed, otherwise
+ * it might never be found.
+ */
+void ctr_gc_write_barrier(ctr_object* owner, ctr_object* value) {
+	if (ctr_gc_marking && owner->info.mark) ctr_gc_gray(value);
+	if (!owner->info.old || owner->info.remembered || value->info.old) return;
+	if (ctr_gc_remembered_count == ctr_gc_remembered_capacity) {
+		if (ctr_gc_remembered_capacity) {
+			ctr_gc_remembered_capacity *= 2;
+			ctr_gc_remembered = ctr_heap_reallocate(ctr_gc_remembered, ctr_gc_remembered_capacity * sizeof(ctr_object*));
+		} else {
+			ctr_gc_remembered_capacity = 64;
+			ctr_gc_remembered = ctr_heap_allocate(ctr_gc_remembered_capacity * sizeof(ctr_object*));
+		}
+	}
+	owner->info.remembered = 1;
+	ctr_gc_remembered[ctr_gc_remembered_count++] = owner;
+}
+
+/**
+ * @internal
+ * Empties the remembered set, after a collection no young objects
+ * are left. If the set has grown it is released as well, it will
+ * be allocated again by the write barrier when needed.
+ */
+void ctr_gc_forget() {
+	ctr_size i;
+	for (i = 0; i < ctr_gc_remembered_count; i++) {
+		ctr_gc_remembered[i]->info.remembered = 0;
+	}
+	ctr_gc_remembered_count = 0;
+	if (ctr_gc_remembered) {
+		ctr_heap_free(ctr_gc_remembered);
+		ctr_gc_remembered = NULL;
+		ctr_gc_remembered_capacity = 0;
+	}
+}
+
+/**
+ * @internal
+ * Promotes all young objects to the old generation.
+ */
+void ctr_gc_promote() {
+	ctr_object* o = ctr_first_young;
+	ctr_object* last = NULL;
+	while(o) {
+		o->info.old = 1;
+		last = o;
+		o = o->gnext;
+	}
+	if (last) {
+		last->gnext = ctr_first_object;
+		ctr_first_object = ctr_first_young;
+	}
+	ctr_first_young = NULL;
+	ctr_gc_young_counter = 0;
+}
+
+/**
+ * @internal
+ * Frees the property or method map of an object, if any.
+ */
+void ctr_gc_release_map(ctr_map* map) {
+	ctr_mapitem* mapItem;
+	ctr_mapitem* tmp;
+	if (map == NULL) return;
+	mapItem = map->head;
+	while(mapItem) {
+		tmp = mapItem->next;
+		ctr_heap_free( mapItem );
+		mapItem = tmp;
+	}
+	if (map->index) {
+		ctr_heap_free( map->index );
+	}
+	ctr_heap_free( map );
+}
+
+/**
+ * @internal
+ * GarbageCollector Release
+ * Frees the memory of an object that has been swept.
+ */
+void ctr_gc_release(ctr_object* currentObject) {
+	// use this to debug GC (i.e. your object gets sweeped)
+	if (currentObject == ctr_gc_watch_object) {
+		printf("[DEBUG] Found watch object. \n");
+		exit(0);
+	}
+	ctr_gc_release_map( currentObject->methods );
+	ctr_gc_release_map( currentObject->properties );
+	switch (currentObject->info.type) {
+		case CTR_OBJECT_TYPE_OTSTRING:
+			if (currentObject->value.svalue != NULL) {
+				if (currentObject->value.svalue->vlen > 0 || currentObject->value.svalue->capacity > 0) {
+					ctr_heap_free( currentObject->value.svalue->value );
+				}
+				ctr_utf8_forget( currentObject->value.svalue );
+				ctr_heap_free( currentObject->value.svalue );
+			}
+		break;
+		case CTR_OBJECT_TYPE_OTARRAY:
+			ctr_heap_free( currentObject->value.avalue->elements );
+			ctr_heap_free( currentObject->value.avalue );
+		break;
+		case CTR_OBJECT_TYPE_OTEX:
+			if (currentObject->value.rvalue != NULL) {
+				currentObject->value.rvalue->destructor( currentObject->value.rvalue );
+				ctr_heap_free( currentObject->value.rvalue );
+			}
+		break;
+	}
+	ctr_heap_free( currentObject );
+}
+
+/**
+ * @internal
+ * GarbageCollector Root Stack
+ * Temporaries that cannot be reached from a context are pinned by
+ * pushing them on the root stack, every collection marks the objects
+ * on this stack. To release pins, pop the stack back to a height
+ * obtained earlier with ctr_gc_internal_roots(). Closing a context
+ * releases the pins made within that context.
+ */
+ctr_object** ctr_gc_roots = NULL;
+ctr_size ctr_gc_roots_count = 0;
+ctr_size ctr_gc_roots_capacity = 0;
+
+ctr_object* ctr_gc_internal_pin( ctr_object* object ) {
+	if ( ctr_gc_roots_count == ctr_gc_roots_capacity ) {
+		if ( ctr_gc_roots_capacity ) {
+			ctr_gc_roots_capacity *= 2;
+			ctr_gc_roots = ctr_heap_reallocate( ctr_gc_roots, ctr_gc_roots_capacity * sizeof(ctr_object*) );
+		} else {
+			ctr_gc_roots_capacity = 256;
+			ctr_gc_roots = ctr_heap_allocate( ctr_gc_roots_capacity * sizeof(ctr_object*) );
+		}
+	}
+	ctr_gc_roots[ctr_gc_roots_count++] = object;
+	return object;
+}
+
+/**
+ * @internal
+ * Returns the height of the root stack.
+ */
+ctr_size ctr_gc_internal_roots() {
+	return ctr_gc_roots_count;
+}
+
+/**
+ * @internal
+ * Releases the pins made since the root stack had the specified height.
+ */
+void ctr_gc_internal_unpin( ctr_size height ) {
+	if ( height < ctr_gc_roots_count ) ctr_gc_roots_count = height;
+}
+
+/**
+ * @internal
+ * Grays the objects on the root stack.
+ */
+void ctr_gc_mark_roots() {
+	ctr_size i;
+	for ( i = 0; i < ctr_gc_roots_count; i++ ) {
+		ctr_gc_gray( ctr_gc_roots[i] );
+	}
+}
+
+/**
+ * @internal
+ * Scans the open contexts: the context objects and the slots
+ * of their frames.
+ */
+void ctr_gc_scan_contexts() {
+	int cid;
+	ctr_size i;
+	for (cid = ctr_context_id; cid > -1; cid--) {
+		if (ctr_contexts[cid]) ctr_gc_scan(ctr_contexts[cid]);
+	}
+	for (i = 0; i < ctr_slots_count; i++) {
+		if (ctr_slots[i]) ctr_gc_gray(ctr_slots[i]);
+	}
 }
 
 /**
  * @internal
  * GarbageCollector Sweeper
+ * Sweeps both generations, the survivors all end up in the old one.
  */
 ctr_object* ctr_gc_watch_object = NULL;
 void ctr_gc_sweep( int all ) {
 	ctr_object* previousObject = NULL;
-	ctr_object* currentObject = ctr_first_object;
+	ctr_object* currentObject;
 	ctr_object* nextObject = NULL;
-	ctr_mapitem* mapItem = NULL;
-	ctr_mapitem* tmp = NULL;
+	int keys = 0;
+	if (all) {
+		ctr_gc_forget();
+		ctr_gc_drop_gray();
+		ctr_gc_marking = 0;
+		if (ctr_gc_roots) ctr_heap_free(ctr_gc_roots);
+		ctr_gc_roots = NULL;
+		ctr_gc_roots_count = 0;
+		ctr_gc_roots_capacity = 0;
+		if (ctr_slots) ctr_heap_free(ctr_slots);
+		ctr_slots = NULL;
+		ctr_slots_count = 0;
+		ctr_slots_capacity = 0;
+	}
+	ctr_gc_promote();
+	currentObject = ctr_first_object;
 	while(currentObject) {
 		ctr_gc_object_counter ++;
+		nextObject = currentObject->gnext;
 		if ( ( currentObject->info.mark==0 && currentObject->info.sticky==0 ) || all){
-			// use this to debug GC (i.e. your object gets sweeped)
-			if (currentObject == ctr_gc_watch_object) {
-				printf("[DEBUG] Found watch object. \n");
-				exit(0);
-			}
 			ctr_gc_dust_counter ++;
+			keys += currentObject->info.keyed;
 			/* remove from linked list */
 			if (previousObject) {
-				if (currentObject->gnext) {
-					previousObject->gnext = currentObject->gnext;
-					nextObject = currentObject->gnext;
-				} else {
-					previousObject->gnext = NULL;
-					nextObject = NULL;
-				}
+				previousObject->gnext = nextObject;
 			} else {
-				if (currentObject->gnext) {
-					ctr_first_object = currentObject->gnext;
-					nextObject = currentObject->gnext;
-				} else {
-					ctr_first_object = NULL;
-					nextObject = NULL;
-				}
-			}
-			if (currentObject->methods->head) {
-				mapItem = currentObject->methods->head;
-				while(mapItem) {
-					tmp = mapItem->next;
-					ctr_heap_free( mapItem );
-					mapItem = tmp;
-				}
-			}
-			if (currentObject->properties->head) {
-				mapItem = currentObject->properties->head;
-				while(mapItem) {
-					tmp = mapItem->next;
-					ctr_heap_free( mapItem );
-					mapItem = tmp;
-				}
-			}
-			ctr_heap_free( currentObject->methods );
-			ctr_heap_free( currentObject->properties );
-			switch (currentObject->info.type) {
-				case CTR_OBJECT_TYPE_OTSTRING:
-					if (currentObject->value.svalue != NULL) {
-						if (currentObject->value.svalue->vlen > 0) {
-							ctr_heap_free( currentObject->value.svalue->value );
-						}
-						ctr_heap_free( currentObject->value.svalue );
-					}
-				break;
-				case CTR_OBJECT_TYPE_OTARRAY:
-					ctr_heap_free( currentObject->value.avalue->elements );
-					ctr_heap_free( currentObject->value.avalue );
-				break;
-				case CTR_OBJECT_TYPE_OTEX:
-					if (currentObject->value.rvalue != NULL) {
-						currentObject->value.rvalue->destructor( currentObject->value.rvalue );
-						ctr_heap_free( currentObject->value.rvalue );
-					}
-				break;
+				ctr_first_object = nextObject;
 			}
-			ctr_heap_free( currentObject );
-			currentObject = nextObject;
+			ctr_gc_release( currentObject );
 		} else {
 			ctr_gc_kept_counter ++;
 			if (currentObject->info.sticky==1) ctr_gc_sticky_counter++;
@@ -136,44 +409,164 @@ void ctr_gc_sweep( int all ) {
 				currentObject->info.mark = 0;
 			}
 			previousObject = currentObject;
-			currentObject = currentObject->gnext;
 		}
+		currentObject = nextObject;
 	}
+	/* a freed cache key may be reallocated at the same address, invalidate inline caches */
+	if (keys) ctr_method_epoch++;
 }
 
 /**
  * @internal
- * Garbage Collector sweep.
+ * GarbageCollector Minor Sweeper
+ * Sweeps the young generation only and promotes the survivors,
+ * the statistics only cover the young generation.
+ */
+void ctr_gc_sweep_young() {
+	ctr_object* previousObject = NULL;
+	ctr_object* currentObject = ctr_first_young;
+	ctr_object* nextObject = NULL;
+	int keys = 0;
+	while(currentObject) {
+		ctr_gc_object_counter ++;
+		nextObject = currentObject->gnext;
+		if ( currentObject->info.mark==0 && currentObject->info.sticky==0 ) {
+			ctr_gc_dust_counter ++;
+			keys += currentObject->info.keyed;
+			if (previousObject) {
+				previousObject->gnext = nextObject;
+			} else {
+				ctr_first_young = nextObject;
+			}
+			ctr_gc_release( currentObject );
+		} else {
+			ctr_gc_kept_counter ++;
+			if (currentObject->info.sticky==1) ctr_gc_sticky_counter++;
+			currentObject->info.mark = 0;
+			previousObject = currentObject;
+		}
+		currentObject = nextObject;
+	}
+	ctr_gc_promote();
+	if (keys) ctr_method_epoch++;
+}
+
+/**
+ * @internal
+ * Returns the time in seconds on a monotonic clock, used to measure
+ * the pauses of the collector (clock() would measure CPU time).
+ */
+double ctr_gc_clock() {
+	#ifdef WIN
+	return (double) clock() / CLOCKS_PER_SEC;
+	#else
+	struct timespec now;
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return (double) now.tv_sec + (double) now.tv_nsec / 1000000000.0;
+	#endif
+}
+
+/**
+ * @internal
+ * Garbage Collector major collection in slices.
+ * The first slice grays the objects referenced by the contexts and
+ * the root stack, every slice scans at most budget objects from the
+ * mark stack (0 means no limit). Meanwhile, the program continues
+ * and the write barrier grays references stored in marked objects.
+ * Once the mark stack is empty, the contexts and the root stack are
+ * scanned again (they are not covered by the write barrier) and
+ * both generations are swept. Minor collections are postponed until
+ * the major collection has finished because they share the marks.
+ */
+void ctr_gc_internal_collect_slice( ctr_size budget ) {
+	double begin = ctr_gc_clock();
+	if ( !ctr_gc_marking ) {
+		ctr_gc_marking = 1;
+		ctr_gc_scan_contexts();
+		ctr_gc_mark_roots();
+	}
+	if ( budget && !ctr_gc_drain( budget ) ) {
+		ctr_gc_major_pause += ctr_gc_clock() - begin;
+		return;
+	}
+	ctr_gc_scan_contexts();
+	ctr_gc_mark_roots();
+	ctr_gc_drain( 0 );
+	ctr_gc_marking = 0;
+	ctr_gc_drop_gray();
+	ctr_gc_forget();
+	ctr_gc_dust_counter = 0;
+	ctr_gc_object_counter = 0;
+	ctr_gc_kept_counter = 0;
+	ctr_gc_sticky_counter = 0;
+	ctr_gc_sweep( 0 );
+	ctr_gc_major_counter++;
+	ctr_gc_major_pause += ctr_gc_clock() - begin;
+}
+
+/**
+ * @internal
+ * Garbage Collector sweep (major collection), finishes an
+ * incremental collection if one is in progress.
  */
 void  ctr_gc_internal_collect() {
-	ctr_object* context;
-	int oldcid;
+	ctr_gc_internal_collect_slice( 0 );
+}
+
+/**
+ * @internal
+ * Garbage Collector minor collection, marks the young objects
+ * reachable from the contexts and the remembered set.
+ */
+void ctr_gc_internal_collect_young() {
+	ctr_size i;
+	double begin;
+	if ( ctr_gc_marking ) return;
+	begin = ctr_gc_clock();
 	ctr_gc_dust_counter = 0;
 	ctr_gc_object_counter = 0;
 	ctr_gc_kept_counter = 0;
 	ctr_gc_sticky_counter = 0;
-	context = ctr_contexts[ctr_context_id];
-	oldcid = ctr_context_id;
-	while(ctr_context_id > -1) {
-		ctr_gc_mark(context);
-		ctr_context_id--;
-		context = ctr_contexts[ctr_context_id];
+	ctr_gc_minor = 1;
+	ctr_gc_scan_contexts();
+	for (i = 0; i < ctr_gc_remembered_count; i++) {
+		ctr_gc_scan(ctr_gc_remembered[i]);
 	}
-	ctr_gc_sweep( 0 );
-	ctr_context_id = oldcid;
+	ctr_gc_mark_roots();
+	ctr_gc_drain( 0 );
+	ctr_gc_minor = 0;
+	ctr_gc_drop_gray();
+	ctr_gc_forget();
+	ctr_gc_sweep_young();
+	ctr_gc_minor_counter++;
+	ctr_gc_minor_pause += ctr_gc_clock() - begin;
 }
 
+/**
+ * @internal
+ * Runs a collection if needed: a major one if memory is about to
+ * run out, a minor one if the young generation is full.
+ * In incremental mode (8) a major collection starts earlier and
+ * each call performs a slice of it, unless memory is about to run
+ * out, then the collection is finished at once.
+ * The testing modes collect at every step: mode 2 the young
+ * generation, mode 4 both generations.
+ */
 void ctr_gc_cycle() {
-	if ( ( ( ctr_gc_mode & 1 ) && ctr_gc_alloc > ( ctr_gc_memlimit * 0.8 ) ) || ctr_gc_mode & 4 ) {
+	int pressure;
+	if ( !( ctr_gc_mode & 7 ) ) return;
+	pressure = ( ( ctr_gc_mode & 4 ) || ctr_gc_alloc > ( ctr_gc_memlimit * 0.8 ) );
+	if ( ctr_gc_marking ) {
+		ctr_gc_internal_collect_slice( ( ( ctr_gc_mode & 8 ) && !pressure ) ? CTR_GC_SLICE : 0 );
+	} else if ( pressure ) {
 		ctr_gc_internal_collect();
+	} else if ( ( ctr_gc_mode & 8 ) && ctr_gc_alloc > ( ctr_gc_memlimit * 0.6 ) ) {
+		ctr_gc_internal_collect_slice( CTR_GC_SLICE );
+	} else if ( ( ( ctr_gc_mode & 2 ) && ctr_gc_young_counter > 0 ) || ctr_gc_young_counter >= CTR_GC_NURSERY_SIZE ) {
+		ctr_gc_internal_collect_young();
 	}
 }
 
-ctr_object* ctr_gc_internal_pin( ctr_object* object ) {
-	ctr_object* key = ctr_build_empty_string();
-	ctr_internal_object_add_property( ctr_contexts[ctr_context_id], key, object, CTR_CATEGORY_PRIVATE_PROPERTY );
-	return key;
-}
  
 
 ctr_object* ctr_gc_collect (ctr_object* myself, ctr_argument* argumentList) {
@@ -189,10 +582,22 @@ ctr_object* ctr_gc_collect (ctr_object* myself, ctr_argument* argumentList) {
  * 2: number of sticky objects
  * 3: number of remaining objects
  * 4: number of removed objects
+ * 5: size classes of the allocator, each one a list with:
+ *    block size, blocks in use, free blocks, slabs
+ * 6: generations, a list with: number of minor collections,
+ *    number of major collections, total pause time of minor and
+ *    major collections (ms), number of young objects
+ * 7: program cache, a list with: number of hits, number of misses,
+ *    bytes held by parsed programs, number of cached programs
+ * 8: highest amount of allocated memory so far
  */
 ctr_object* ctr_gc_memory(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_object* list = ctr_array_new( CtrStdArray, NULL );
+	ctr_object* pools;
+	ctr_object* pool;
+	ctr_program_cache_entry* entry;
 	ctr_argument* args = ctr_heap_allocate(sizeof(ctr_argument));
+	int i;
 	args->object = ctr_build_number_from_float( ctr_gc_alloc );
 	ctr_array_push( list, args );
 	args->object = ctr_build_number_from_float( ctr_gc_object_counter );
@@ -203,6 +608,49 @@ ctr_object* ctr_gc_memory(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_array_push( list, args );
 	args->object = ctr_build_number_from_float( ctr_gc_dust_counter );
 	ctr_array_push( list, args );
+	pools = ctr_array_new( CtrStdArray, NULL );
+	args->object = pools;
+	ctr_array_push( list, args );
+	for ( i = 0; i < CTR_POOL_CLASSES; i++ ) {
+		pool = ctr_array_new( CtrStdArray, NULL );
+		args->object = pool;
+		ctr_array_push( pools, args );
+		args->object = ctr_build_number_from_float( ( i + 1 ) * CTR_POOL_CLASS_WIDTH );
+		ctr_array_push( pool, args );
+		args->object = ctr_build_number_from_float( ctr_pools[i].used );
+		ctr_array_push( pool, args );
+		args->object = ctr_build_number_from_float( ctr_pools[i].available );
+		ctr_array_push( pool, args );
+		args->object = ctr_build_number_from_float( ctr_pools[i].slabs );
+		ctr_array_push( pool, args );
+	}
+	pool = ctr_array_new( CtrStdArray, NULL );
+	args->object = pool;
+	ctr_array_push( list, args );
+	args->object = ctr_build_number_from_float( ctr_gc_minor_counter );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_gc_major_counter );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_gc_minor_pause * 1000 );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_gc_major_pause * 1000 );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_gc_young_counter );
+	ctr_array_push( pool, args );
+	pool = ctr_array_new( CtrStdArray, NULL );
+	args->object = pool;
+	ctr_array_push( list, args );
+	args->object = ctr_build_number_from_float( ctr_program_cache_hits );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_program_cache_misses );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_program_cache_bytes );
+	ctr_array_push( pool, args );
+	for ( i = 0, entry = ctr_program_cache; entry; entry = entry->next ) i++;
+	args->object = ctr_build_number_from_float( i );
+	ctr_array_push( pool, args );
+	args->object = ctr_build_number_from_float( ctr_gc_alloc_peak );
+	ctr_array_push( list, args );
 	ctr_heap_free(args);
 	return list;
 }
@@ -241,11 +689,18 @@ ctr_object* ctr_gc_setmemlimit(ctr_object* myself, ctr_argument* argumentList) {
  *
  * Available Modes:
  * 0 - No Garbage Collection
- * 1 - Activate Garbage Collector (default)
- * 4 - Activate Garbage Collector for every single step (testing only)
+ * 1 - Activate Garbage Collector (default), collects the young
+ *     generation whenever it is full and both generations
+ *     if memory is about to run out
+ * 2 - Collect the young generation at every single step (testing only)
+ * 4 - Collect both generations at every single step (testing only)
+ * 8 - Incremental, combined with 1: major collections mark objects
+ *     in small slices spread over multiple steps to keep pauses short,
+ *     the media screen loop switches it on unless a mode was chosen
  */
 ctr_object* ctr_gc_setmode(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_gc_mode = (int) ctr_internal_cast2number( argumentList->object )->value.nvalue;
+	ctr_gc_mode_chosen = 1;
 	return myself;
 }
 
@@ -264,8 +719,7 @@ ctr_object* ctr_gc_getmode(ctr_object* myself, ctr_argument* argumentList) {
 ctr_object* ctr_program_shell(ctr_object* myself, ctr_argument* argumentList) {
 	FILE* stream;
 	char* outputBuffer;
-	ctr_argument* newArgumentList;
-	ctr_object* appendString;
+	size_t chunk;
 	ctr_object* outputString;
 	outputBuffer = ctr_heap_allocate( 512 );
 	ctr_object* arg = ctr_internal_cast2string(argumentList->object);
@@ -273,19 +727,19 @@ ctr_object* ctr_program_shell(ctr_object* myself, ctr_argument* argumentList) {
 	char* comString = ctr_heap_allocate( sizeof( char ) * ( vlen + 1 ) );
 	memcpy(comString, arg->value.svalue->value, vlen);
 	memcpy(comString+vlen,"\0",1);
-	newArgumentList = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
 	if ( !( stream = popen( comString, "r" ) ) ) {
 		CtrStdFlow = ctr_error( CTR_ERR_EXEC, 0 );
+		ctr_heap_free( outputBuffer );
+		ctr_heap_free( comString );
+		return CtrStdNil;
 	}
 	outputString = ctr_build_empty_string();
-	while ( fgets( outputBuffer, 512, stream ) ) {
-		appendString = ctr_build_string_from_cstring( outputBuffer );
-		newArgumentList->object = appendString;
-		ctr_string_append( outputString, newArgumentList );
+	/* append the chunks to the output directly, it grows geometrically */
+	while ( ( chunk = fread( outputBuffer, 1, 512, stream ) ) > 0 ) {
+		ctr_internal_string_append( outputString->value.svalue, outputBuffer, chunk );
 	}
 	pclose( stream );
 	ctr_heap_free( outputBuffer );
-	ctr_heap_free( newArgumentList );
 	ctr_heap_free( comString );
 	return outputString;
 }
@@ -330,6 +784,177 @@ ctr_object* ctr_program_tostring(ctr_object* myself, ctr_argument* argumentList)
 }
 
 
+/**
+ * @internal
+ *
+ * ProgramCache
+ *
+ * Keeps the parsed programs of included files. An entry is identified by
+ * the canonical path of the file and it remains valid as long as the
+ * device, inode, size and modification time (in nanoseconds where the
+ * platform offers them) of the file are unchanged. A file rewritten with
+ * the same size within the timestamp granularity of the file system goes
+ * unnoticed.
+ * The parsed code lives in tracked memory, if the tracker rewinds
+ * beyond an entry (i.e. the include took place during an evaluation)
+ * the entry is dropped (see ctr_heap_tracker_rewind).
+ */
+ctr_program_cache_entry* ctr_program_cache = NULL;
+uint64_t ctr_program_cache_hits = 0;
+uint64_t ctr_program_cache_misses = 0;
+uint64_t ctr_program_cache_bytes = 0;
+
+/**
+ * @internal
+ *
+ * ProgramCacheIdentify
+ *
+ * Determines the canonical path and the identity of a program file.
+ * Files that cannot be found on disk (i.e. media assets in a package)
+ * are identified by their path only.
+ */
+void ctr_program_cache_identify( char* path, char* canonicalPath, ctr_program_cache_entry* identity ) {
+	struct stat st;
+	identity->device = 0;
+	identity->inode = 0;
+	identity->size = 0;
+	identity->mtime = 0;
+	identity->mtime_nsec = 0;
+	if ( realpath( path, canonicalPath ) == NULL || stat( canonicalPath, &st ) != 0 ) {
+		strncpy( canonicalPath, path, PATH_MAX - 1 );
+		canonicalPath[ PATH_MAX - 1 ] = '\0';
+		return;
+	}
+	identity->device = (uint64_t) st.st_dev;
+	identity->inode = (uint64_t) st.st_ino;
+	identity->size = (uint64_t) st.st_size;
+	identity->mtime = (int64_t) st.st_mtime;
+#if defined(__APPLE__)
+	identity->mtime_nsec = (int64_t) st.st_mtimespec.tv_nsec;
+#elif !defined(WIN)
+	identity->mtime_nsec = (int64_t) st.st_mtim.tv_nsec;
+#endif
+}
+
+/**
+ * @internal
+ *
+ * ProgramCacheGet
+ *
+ * Returns the parsed program for the specified path if the file
+ * has not changed since it has been parsed, otherwise NULL.
+ */
+ctr_tnode* ctr_program_cache_get( char* path ) {
+	char canonicalPath[PATH_MAX];
+	ctr_program_cache_entry identity;
+	ctr_program_cache_entry* entry;
+	ctr_program_cache_identify( path, canonicalPath, &identity );
+	for ( entry = ctr_program_cache; entry; entry = entry->next ) {
+		if ( strcmp( entry->path, canonicalPath ) != 0 ) continue;
+		if ( entry->device == identity.device
+		&& entry->inode == identity.inode
+		&& entry->size == identity.size
+		&& entry->mtime == identity.mtime
+		&& entry->mtime_nsec == identity.mtime_nsec ) {
+			ctr_program_cache_hits++;
+			return entry->program;
+		}
+		break;
+	}
+	ctr_program_cache_misses++;
+	return NULL;
+}
+
+/**
+ * @internal
+ *
+ * ProgramCacheRelease
+ *
+ * Frees the parsed code of a stale entry. If a block or a message on
+ * the call stack still refers to it, it is kept until the program ends.
+ */
+void ctr_program_cache_release( ctr_program_cache_entry* entry ) {
+	ctr_object* o;
+	int i;
+	for ( i = 0; i < ctr_callstack_index; i++ ) {
+		if ( ctr_heap_tracker_owns( ctr_callstack[i], entry->memblock, entry->memend ) ) return;
+	}
+	for ( i = 0; i < 2; i++ ) {
+		for ( o = i ? ctr_first_young : ctr_first_object; o; o = o->gnext ) {
+			if ( o->info.type == CTR_OBJECT_TYPE_OTBLOCK
+			&& ctr_heap_tracker_owns( o->value.block, entry->memblock, entry->memend ) ) return;
+		}
+	}
+	/* the profiler labels frames by node */
+	ctr_profile_rewind();
+	ctr_heap_tracker_release( entry->memblock, entry->memend );
+}
+
+/**
+ * @internal
+ *
+ * ProgramCachePut
+ *
+ * Stores a parsed program in the cache, memblock is the tracker position
+ * before parsing, everything tracked since then belongs to the program.
+ * A stale entry for the same file is replaced, its parsed code is
+ * released.
+ */
+void ctr_program_cache_put( char* path, ctr_tnode* program, size_t memblock ) {
+	char canonicalPath[PATH_MAX];
+	ctr_program_cache_entry identity;
+	ctr_program_cache_entry* entry;
+	size_t bytes = ctr_heap_tracker_size( memblock );
+	size_t memend = ctr_heap_tracker_memoryblocknumber();
+	ctr_heap_arena_close();
+	ctr_program_cache_identify( path, canonicalPath, &identity );
+	for ( entry = ctr_program_cache; entry; entry = entry->next ) {
+		if ( strcmp( entry->path, canonicalPath ) == 0 ) break;
+	}
+	if ( entry == NULL ) {
+		entry = ctr_heap_allocate_tracked( sizeof( ctr_program_cache_entry ) );
+		entry->path = ctr_heap_allocate_tracked( strlen( canonicalPath ) + 1 );
+		memcpy( entry->path, canonicalPath, strlen( canonicalPath ) + 1 );
+		entry->next = ctr_program_cache;
+		ctr_program_cache = entry;
+	} else {
+		ctr_program_cache_bytes -= entry->bytes;
+		ctr_program_cache_release( entry );
+	}
+	entry->device = identity.device;
+	entry->inode = identity.inode;
+	entry->size = identity.size;
+	entry->mtime = identity.mtime;
+	entry->mtime_nsec = identity.mtime_nsec;
+	entry->program = program;
+	entry->memblock = memblock;
+	entry->memend = memend;
+	entry->bytes = bytes;
+	ctr_program_cache_bytes += bytes;
+}
+
+/**
+ * @internal
+ *
+ * ProgramCacheRewind
+ *
+ * Drops the entries whose parsed code will be freed by rewinding
+ * the memory tracker to the specified position.
+ */
+void ctr_program_cache_rewind( size_t memoryBlockNumber ) {
+	ctr_program_cache_entry** link = &ctr_program_cache;
+	ctr_program_cache_entry* entry;
+	while ( *link ) {
+		entry = *link;
+		if ( entry->memblock >= memoryBlockNumber ) {
+			ctr_program_cache_bytes -= entry->bytes;
+			*link = entry->next;
+		} else {
+			link = &entry->next;
+		}
+	}
+}
+
 /**
  * @def
  * [ Program ] use: [ String ]
@@ -340,6 +965,7 @@ ctr_object* ctr_program_tostring(ctr_object* myself, ctr_argument* argumentList)
 
 ctr_object* ctr_program_include(ctr_object* myself, ctr_argument* argumentList) {
 	ctr_size vlen;
+	size_t memblock;
 	char* pathString;
 	char* pathStringCopy;
 	ctr_object* path;
@@ -348,12 +974,8 @@ ctr_object* ctr_program_include(ctr_object* myself, ctr_argument* argumentList)
 	uint64_t program_size;
 	path = ctr_internal_cast2string(argumentList->object);
 	vlen = path->value.svalue->vlen;
-	pathString = ctr_heap_allocate_tracked(sizeof(char)*(vlen+1)); //needed until end, pathString appears in stracktrace
 	pathStringCopy = ctr_heap_allocate(sizeof(char)*(vlen+1)); //Because dirname() might modify param
-	if (path == NULL) return myself;
 	program_size = 0;
-	memcpy(pathString, path->value.svalue->value, vlen);
-	memcpy(pathString+vlen,"\0",1);
 	memcpy(pathStringCopy, path->value.svalue->value, vlen);
 	memcpy(pathStringCopy+vlen,"\0",1);
 	char* current_working_dir = ctr_heap_allocate(1000);
@@ -362,15 +984,22 @@ ctr_object* ctr_program_include(ctr_object* myself, ctr_argument* argumentList)
 		ctr_heap_free(pathStringCopy);
 		return CtrStdNil;
 	}
-	prg = ctr_internal_readf(pathString, &program_size);
-	parsedCode = ctr_cparse_parse(prg, pathString);
+	parsedCode = ctr_program_cache_get(pathStringCopy);
+	if (parsedCode == NULL) {
+		memblock = ctr_heap_tracker_memoryblocknumber();
+		pathString = ctr_heap_allocate_tracked(sizeof(char)*(vlen+1)); //needed until end, pathString appears in stracktrace
+		memcpy(pathString, pathStringCopy, vlen+1);
+		prg = ctr_internal_readf(pathString, &program_size);
+		ctr_heap_track(prg, program_size); /* kept along with the parsed code, nodes refer to it */
+		ctr_heap_arena_close(); /* the parsed code gets arena blocks of its own */
+		parsedCode = ctr_cparse_parse(prg, pathString);
+		if (parsedCode) ctr_program_cache_put(pathString, parsedCode, memblock);
+	}
 	if (parsedCode == NULL || (chdir(dirname(pathStringCopy)) != 0)) {
-		ctr_heap_free( prg );
 		ctr_heap_free(current_working_dir);
 		ctr_heap_free(pathStringCopy);
 		return CtrStdNil;
 	}
-	ctr_heap_free( prg );
 	ctr_cwlk_subprogram++;
 	ctr_cwlk_run(parsedCode);
 	ctr_cwlk_subprogram--;
@@ -1497,3 +2126,247 @@ ctr_object* ctr_slurp_to_string( ctr_object* myself, ctr_argument* argumentList
 	}
 	return commandObj;
 }
+
+/**
+ * @internal
+ *
+ * Profiler
+ *
+ * Statistical profiler, enabled by setting the environment variable
+ * CITRINE_PROFILE to the path of an output file. Every CTR_PROFILE_INTERVAL
+ * microseconds of CPU time the SIGPROF handler raises ctr_profile_tick,
+ * the next message send then records the call stack of the program.
+ * Identical stacks are counted together and written at exit as folded
+ * stacks, the input format of flamegraph tools:
+ *
+ * program;selector (file:line);selector (file:line) count
+ *
+ * The profiler uses the C allocator directly so it does not show up
+ * in the memory statistics of the program.
+ */
+volatile sig_atomic_t ctr_profile_tick = 0;
+char* ctr_profile_path = NULL;
+ctr_profile_table ctr_profile_frames;
+ctr_profile_table ctr_profile_stacks;
+char* ctr_profile_buffer = NULL;
+ctr_size ctr_profile_buffer_size = 0;
+
+void ctr_profile_handler( int signal ) {
+	ctr_profile_tick = 1;
+}
+
+/**
+ * @internal
+ *
+ * ProfileHash
+ *
+ * Hashes a node pointer or a folded stack (FNV-1a).
+ */
+uint64_t ctr_profile_hash( ctr_tnode* node, char* text ) {
+	uint64_t hash = 14695981039346656037ULL;
+	if ( node ) return ( (uint64_t) (uintptr_t) node >> 4 ) * 11400714819323198485ULL;
+	while ( *text ) {
+		hash ^= (unsigned char) *text++;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+ * @internal
+ *
+ * ProfileFind
+ *
+ * Returns the slot for a node (frames) or a folded stack (stacks),
+ * the table grows when it is half full.
+ */
+ctr_profile_entry* ctr_profile_find( ctr_profile_table* table, ctr_tnode* node, char* text ) {
+	ctr_profile_entry* entries;
+	ctr_profile_entry* entry;
+	ctr_size size;
+	ctr_size i;
+	if ( ( table->count + 1 ) * 2 > table->size ) {
+		entries = table->entries;
+		size = table->size;
+		table->size = size ? size * 2 : 1024;
+		table->entries = calloc( table->size, sizeof( ctr_profile_entry ) );
+		table->count = 0;
+		for ( i = 0; i < size; i++ ) {
+			if ( entries[i].text == NULL ) continue;
+			entry = ctr_profile_find( table, entries[i].node, entries[i].text );
+			*entry = entries[i];
+			table->count++;
+		}
+		free( entries );
+	}
+	i = ctr_profile_hash( node, text ) & ( table->size - 1 );
+	while ( table->entries[i].text ) {
+		entry = &table->entries[i];
+		if ( node ? ( entry->node == node ) : ( strcmp( entry->text, text ) == 0 ) ) {
+			return entry;
+		}
+		i = ( i + 1 ) & ( table->size - 1 );
+	}
+	return &table->entries[i];
+}
+
+/**
+ * @internal
+ *
+ * ProfileFrame
+ *
+ * Returns the label of a frame in the call stack: the selector
+ * or variable name followed by the source location (line and column).
+ */
+char* ctr_profile_frame( ctr_tnode* node ) {
+	ctr_profile_entry* entry = ctr_profile_find( &ctr_profile_frames, node, NULL );
+	char* program = NULL;
+	char* label;
+	size_t size;
+	int line;
+	ctr_size i;
+	if ( entry->text ) return entry->text;
+	line = ctr_cwlk_source_line( node, &program );
+	size = node->vlen + ( program ? strlen( program ) : 0 ) + 32;
+	label = malloc( size );
+	if ( line > -1 ) {
+		snprintf( label, size, "%.*s (%s:%d:%u)", (int) node->vlen, node->value, program, line + 1, node->column );
+	} else {
+		snprintf( label, size, "%.*s", (int) node->vlen, node->value );
+	}
+	/* semicolons separate frames, newlines separate stacks */
+	for ( i = 0; label[i]; i++ ) {
+		if ( label[i] == ';' ) label[i] = ',';
+		if ( label[i] == '\n' || label[i] == '\r' ) label[i] = ' ';
+	}
+	entry->node = node;
+	entry->text = label;
+	ctr_profile_frames.count++;
+	return label;
+}
+
+/**
+ * @internal
+ *
+ * ProfileSample
+ *
+ * Records the current call stack, invoked from the message dispatcher
+ * after a tick of the profiler timer.
+ */
+void ctr_profile_sample() {
+	ctr_profile_entry* entry;
+	ctr_size length;
+	ctr_size frame_length;
+	char* frame;
+	int i;
+	ctr_profile_tick = 0;
+	length = strlen( ctr_mode_input_file );
+	if ( length + 1 > ctr_profile_buffer_size ) {
+		ctr_profile_buffer_size = length + 1024;
+		ctr_profile_buffer = realloc( ctr_profile_buffer, ctr_profile_buffer_size );
+	}
+	memcpy( ctr_profile_buffer, ctr_mode_input_file, length );
+	for ( i = 0; i < ctr_callstack_index; i++ ) {
+		frame = ctr_profile_frame( ctr_callstack[i] );
+		frame_length = strlen( frame );
+		if ( length + frame_length + 2 > ctr_profile_buffer_size ) {
+			ctr_profile_buffer_size = ( length + frame_length + 2 ) * 2;
+			ctr_profile_buffer = realloc( ctr_profile_buffer, ctr_profile_buffer_size );
+		}
+		ctr_profile_buffer[length++] = ';';
+		memcpy( ctr_profile_buffer + length, frame, frame_length );
+		length += frame_length;
+	}
+	ctr_profile_buffer[length] = '\0';
+	entry = ctr_profile_find( &ctr_profile_stacks, NULL, ctr_profile_buffer );
+	if ( entry->text == NULL ) {
+		entry->text = malloc( length + 1 );
+		memcpy( entry->text, ctr_profile_buffer, length + 1 );
+		ctr_profile_stacks.count++;
+	}
+	entry->count++;
+}
+
+/**
+ * @internal
+ *
+ * ProfileRewind
+ *
+ * Forgets the frame labels, nodes may be freed
+ * (see ctr_heap_tracker_rewind).
+ */
+void ctr_profile_rewind() {
+	ctr_size i;
+	if ( ctr_profile_frames.entries == NULL ) return;
+	for ( i = 0; i < ctr_profile_frames.size; i++ ) {
+		free( ctr_profile_frames.entries[i].text );
+	}
+	free( ctr_profile_frames.entries );
+	ctr_profile_frames.entries = NULL;
+	ctr_profile_frames.size = 0;
+	ctr_profile_frames.count = 0;
+}
+
+/**
+ * @internal
+ *
+ * ProfileWrite
+ *
+ * Stops the profiler and writes the folded stacks (registered with atexit).
+ */
+void ctr_profile_write() {
+	FILE* output;
+	ctr_size i;
+	#ifndef WIN
+	struct itimerval timer;
+	memset( &timer, 0, sizeof( timer ) );
+	setitimer( ITIMER_PROF, &timer, NULL );
+	#endif
+	if ( ctr_profile_path == NULL ) return;
+	output = fopen( ctr_profile_path, "w" );
+	if ( output == NULL ) {
+		fprintf( stderr, CTR_ERR_FOPEN );
+	}
+	for ( i = 0; i < ctr_profile_stacks.size; i++ ) {
+		if ( ctr_profile_stacks.entries[i].text == NULL ) continue;
+		if ( output ) {
+			fprintf( output, "%s %" PRIu64 "\n", ctr_profile_stacks.entries[i].text, ctr_profile_stacks.entries[i].count );
+		}
+		free( ctr_profile_stacks.entries[i].text );
+	}
+	if ( output ) fclose( output );
+	free( ctr_profile_stacks.entries );
+	ctr_profile_stacks.entries = NULL;
+	ctr_profile_rewind();
+	free( ctr_profile_buffer );
+	ctr_profile_buffer = NULL;
+	free( ctr_profile_path );
+	ctr_profile_path = NULL;
+}
+
+/**
+ * @internal
+ *
+ * ProfileStart
+ *
+ * Starts the profiler timer, the folded stacks will be written
+ * to the specified file when the program ends.
+ */
+void ctr_profile_start( char* path ) {
+	#ifndef WIN
+	struct sigaction action;
+	struct itimerval timer;
+	ctr_profile_path = malloc( strlen( path ) + 1 );
+	memcpy( ctr_profile_path, path, strlen( path ) + 1 );
+	memset( &action, 0, sizeof( action ) );
+	action.sa_handler = ctr_profile_handler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset( &action.sa_mask );
+	sigaction( SIGPROF, &action, NULL );
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = CTR_PROFILE_INTERVAL;
+	timer.it_value = timer.it_interval;
+	setitimer( ITIMER_PROF, &timer, NULL );
+	atexit( ctr_profile_write );
+	#endif
+}
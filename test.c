@@ -116,20 +116,81 @@ void ctr_coretest_parser() {
  */
 void ctr_coretest_memory() {
 	char* chunk;
+	char* recycled;
 	size_t size;
-	size_t expected_size;
 	chunk = ctr_heap_allocate(10);
 	size = (size_t) *((size_t*) ((char*)chunk - sizeof(size_t)));
-	expected_size = (ctr_gc_mode & 8) ? 32 : (10 + sizeof(size_t));
-	ctr_test(size == expected_size);
+	ctr_test(size == 32);
 	chunk = ctr_heap_allocate(100);
 	size = (size_t) *((size_t*) ((char*)chunk - sizeof(size_t)));
-	expected_size = (ctr_gc_mode & 8) ? 128 : (100 + sizeof(size_t));
-	ctr_test(size == expected_size);
+	ctr_test(size == 112);
 	chunk = ctr_heap_allocate(32);
 	size = (size_t) *((size_t*) ((char*)chunk - sizeof(size_t)));
-	expected_size = (ctr_gc_mode & 8) ? 64 : (32 + sizeof(size_t));
-	ctr_test(size == expected_size);
+	ctr_test(size == 48);
+	ctr_heap_free(chunk);
+	recycled = ctr_heap_allocate(36);
+	ctr_test(recycled == chunk);
+	chunk = ctr_heap_allocate(1000);
+	size = (size_t) *((size_t*) ((char*)chunk - sizeof(size_t)));
+	ctr_test(size == 1000 + sizeof(size_t));
+}
+
+/**
+ * Compares a substring search function with the scalar one
+ * on random haystacks and needles made of a small alphabet,
+ * returns the number of differences.
+ */
+int ctr_coretest_memmem_compare( char* (*search)(char*, long, char*, long, int) ) {
+	char haystack[300];
+	char needle[40];
+	unsigned int seed = 7;
+	long hlen, nlen, i;
+	int n, reverse;
+	int differences = 0;
+	for ( n = 0; n < 5000; n++ ) {
+		seed = seed * 1103515245 + 12345;
+		hlen = ( seed >> 8 ) % 300;
+		seed = seed * 1103515245 + 12345;
+		nlen = 1 + ( seed >> 8 ) % 39;
+		for ( i = 0; i < hlen; i++ ) {
+			seed = seed * 1103515245 + 12345;
+			haystack[i] = "abc"[( seed >> 8 ) % 3];
+		}
+		for ( i = 0; i < nlen; i++ ) {
+			seed = seed * 1103515245 + 12345;
+			needle[i] = "abc"[( seed >> 8 ) % 3];
+		}
+		/* make sure there is something to be found half of the time */
+		if ( n % 2 && hlen >= nlen ) {
+			seed = seed * 1103515245 + 12345;
+			memcpy( needle, haystack + ( seed >> 8 ) % ( hlen - nlen + 1 ), nlen );
+		}
+		for ( reverse = 0; reverse < 2; reverse++ ) {
+			if ( search( haystack, hlen, needle, nlen, reverse ) != ctr_internal_memmem_scalar( haystack, hlen, needle, nlen, reverse ) ) {
+				differences++;
+			}
+		}
+	}
+	return differences;
+}
+
+/**
+ * Test substring search, the vectorized versions
+ * must give the same results as the scalar one.
+ */
+void ctr_coretest_memmem() {
+	char text[] = "abcabc";
+	int differences;
+	ctr_test( ctr_internal_memmem( text, 6, "bc", 2, 0 ) == text + 1 );
+	ctr_test( ctr_internal_memmem( text, 6, "bc", 2, 1 ) == text + 4 );
+	ctr_test( ctr_internal_memmem( text, 6, "cc", 2, 0 ) == NULL );
+	differences = ctr_coretest_memmem_compare( &ctr_internal_memmem );
+#ifdef CTR_MEMMEM_X86
+	__builtin_cpu_init();
+	if ( __builtin_cpu_supports( "sse2" ) ) differences += ctr_coretest_memmem_compare( &ctr_internal_memmem_sse2 );
+	if ( __builtin_cpu_supports( "avx2" ) ) differences += ctr_coretest_memmem_compare( &ctr_internal_memmem_avx2 );
+#endif
+	ctr_test( differences == 0 );
 }
 
 /**
@@ -140,6 +201,7 @@ void ctr_coretest() {
 	ctr_coretest_tokens();
 	ctr_coretest_parser();
 	ctr_coretest_memory();
+	ctr_coretest_memmem();
 	exit(0);
 }
 
@@ -209,11 +209,12 @@ void ctr_translate_generate_dicts(char* hfile1, char* hfile2) {
 	if (f1 == NULL || f2 == NULL) {
 		ctr_print_error(CTR_TERR_DICT, 1);
 	}
-	char* word = calloc(CTR_TRANSLATE_MAX_WORD_LEN, 1);
-	char* translation = calloc(CTR_TRANSLATE_MAX_WORD_LEN, 1);
-	char* key1  = calloc(CTR_TRANSLATE_MAX_WORD_LEN, 1);
-	char* key2  = calloc(CTR_TRANSLATE_MAX_WORD_LEN, 1);
-	char* modifier = calloc(CTR_TRANSLATE_MAX_WORD_LEN, 1);
+	/* fscanf reads up to CTR_TRANSLATE_MAX_WORD_LEN bytes plus the terminating NUL */
+	char* word = calloc(CTR_TRANSLATE_MAX_WORD_LEN + 1, 1);
+	char* translation = calloc(CTR_TRANSLATE_MAX_WORD_LEN + 1, 1);
+	char* key1  = calloc(CTR_TRANSLATE_MAX_WORD_LEN + 1, 1);
+	char* key2  = calloc(CTR_TRANSLATE_MAX_WORD_LEN + 1, 1);
+	char* modifier = calloc(CTR_TRANSLATE_MAX_WORD_LEN + 1, 1);
 	char* format;
 	char* buffer;
 	char* keys_for_strings = getenv("STRINGKEYS");
@@ -456,15 +457,19 @@ int ctr_translate_translate(char* v, ctr_size l, ctr_dict* dictionary, char cont
 		for (i = 0; i<l; i++) {
 				fwrite(v+i,1,1,stdout);
 				if (*(v + i)==ctr_clex_param_prefix_char) {
-					memcpy(remainder,v+i+1,(l-i));
+					if ((l-i)>CTR_TRANSLATE_MAX_WORD_LEN) {
+						ctr_print_error(CTR_TERR_BUFF, 1);
+					}
+					memcpy(remainder,v+i+1,(l-i-1));
 					found = 1;
 					break;
 				}
 			}
 	}
 	if (!found) {
-		buffer = ctr_heap_allocate( 600 );
 		warning = CTR_TERR_WARN;
+		/* tokens are not limited in length, size the warning accordingly */
+		buffer = ctr_heap_allocate( strlen(warning) + l + 1 );
 		memcpy(buffer, warning, strlen(warning));
 		memcpy(buffer + (strlen(warning)), v, l);
 		ctr_print_error( buffer, -1 );
@@ -48,3 +48,131 @@ ctr_size getBytesUtf8(char* strval, long startByte, ctr_size lenUChar) {
 	}
 	return bytes;
 }
+
+/**
+ * UTF8Length
+ *
+ * Returns the number of characters of a string. The count is cached,
+ * along with a flag telling whether every character is a single byte.
+ */
+ctr_size ctr_utf8_length(ctr_string* s) {
+	if (!s->counted) {
+		s->ulen = ctr_getutf8len(s->value, s->vlen);
+		s->ascii = (s->ulen == s->vlen);
+		s->counted = 1;
+	}
+	return s->ulen;
+}
+
+/**
+ * Strings of literal constants having an offset index. Constants are
+ * not released by the collector, they belong to the parsed code, so
+ * their indexes are freed when the memory tracker frees the code
+ * (see ctr_utf8_drop).
+ */
+ctr_string** ctr_utf8_constants = NULL;
+ctr_size ctr_utf8_constants_count = 0;
+ctr_size ctr_utf8_constants_capacity = 0;
+
+/**
+ * UTF8Register
+ *
+ * Registers the string of a literal constant that has got an index.
+ */
+void ctr_utf8_register(ctr_string* s) {
+	if (ctr_utf8_constants_count == ctr_utf8_constants_capacity) {
+		ctr_utf8_constants_capacity = ctr_utf8_constants_capacity ? ctr_utf8_constants_capacity * 2 : 16;
+		if (ctr_utf8_constants) {
+			ctr_utf8_constants = ctr_heap_reallocate(ctr_utf8_constants, ctr_utf8_constants_capacity * sizeof(ctr_string*));
+		} else {
+			ctr_utf8_constants = ctr_heap_allocate(ctr_utf8_constants_capacity * sizeof(ctr_string*));
+		}
+	}
+	ctr_utf8_constants[ctr_utf8_constants_count++] = s;
+}
+
+/**
+ * UTF8Drop
+ *
+ * Frees the indexes of the registered constants that live in the
+ * memory blocks tracked from the first position up to the last one
+ * (exclusive), must be called before these blocks are freed.
+ */
+void ctr_utf8_drop(size_t from, size_t to) {
+	ctr_size i = 0;
+	while (i < ctr_utf8_constants_count) {
+		if (ctr_heap_tracker_owns(ctr_utf8_constants[i], from, to)) {
+			ctr_heap_free(ctr_utf8_constants[i]->index);
+			ctr_utf8_constants[i]->index = NULL;
+			ctr_utf8_constants[i] = ctr_utf8_constants[--ctr_utf8_constants_count];
+		} else {
+			i++;
+		}
+	}
+	if (ctr_utf8_constants_count == 0 && ctr_utf8_constants) {
+		ctr_heap_free(ctr_utf8_constants);
+		ctr_utf8_constants = NULL;
+		ctr_utf8_constants_capacity = 0;
+	}
+}
+
+/**
+ * UTF8Offset
+ *
+ * Returns the byte offset of the character at position n (starting
+ * at 0, n may not exceed the length of the string). For long strings
+ * having multibyte characters, the byte offset of every
+ * CTR_UTF8_INDEX_STEP characters is stored in an index on first use,
+ * so only the last part needs to be scanned. Symbols do not get an
+ * index because they are never released, the indexes of literals
+ * are registered to be freed along with the parsed code.
+ */
+ctr_size ctr_utf8_offset(ctr_object* string, ctr_size n) {
+	ctr_string* s = string->value.svalue;
+	ctr_size i;
+	ctr_size b;
+	ctr_size steps;
+	ctr_utf8_length(s);
+	if (s->ascii) return n;
+	if (s->index == NULL) {
+		if (s->ulen < CTR_UTF8_INDEX_STEP * 4 || string->info.symbol) {
+			return getBytesUtf8(s->value, 0, n);
+		}
+		steps = s->ulen / CTR_UTF8_INDEX_STEP + 1;
+		s->index = ctr_heap_allocate(steps * sizeof(ctr_size));
+		if (string->info.constant) ctr_utf8_register(s);
+		b = 0;
+		for(i = 0; i < steps; i++) {
+			s->index[i] = b;
+			if (i + 1 < steps) b += getBytesUtf8(s->value, b, CTR_UTF8_INDEX_STEP);
+		}
+	}
+	i = n / CTR_UTF8_INDEX_STEP;
+	return s->index[i] + getBytesUtf8(s->value, s->index[i], n - (i * CTR_UTF8_INDEX_STEP));
+}
+
+/**
+ * UTF8Position
+ *
+ * Returns the number of characters before the specified byte offset.
+ */
+ctr_size ctr_utf8_position(ctr_string* s, ctr_size byte_index) {
+	ctr_utf8_length(s);
+	if (s->ascii) return byte_index;
+	return ctr_getutf8len(s->value, byte_index);
+}
+
+/**
+ * UTF8Forget
+ *
+ * Discards the cached length and index of a string,
+ * to be called whenever its contents change.
+ */
+void ctr_utf8_forget(ctr_string* s) {
+	s->counted = 0;
+	s->ascii = 0;
+	if (s->index) {
+		ctr_heap_free(s->index);
+		s->index = NULL;
+	}
+}
@@ -0,0 +1,558 @@
+#include "citrine.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
+
+int ctr_vm_mode = 0;
+
+#define CTR_VM_FLOW_OK (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak)
+
+/**
+ * Compiler state, instructions and constants are collected in
+ * growing buffers and copied into a single tracked block once the
+ * instruction list is complete.
+ */
+struct ctr_vm_compiler {
+	ctr_instruction* instructions;
+	ctr_constant* constants;
+	uint32_t length;
+	uint32_t capacity;
+	uint32_t constant_count;
+	uint32_t constant_capacity;
+	uint32_t depth;
+	uint32_t stack_size;
+	uint32_t frames;
+	uint32_t frame_count;
+	int failed;
+};
+typedef struct ctr_vm_compiler ctr_vm_compiler;
+
+/**
+ * State of a message expression being evaluated,
+ * mirrors the local variables of the walker (ctr_cwlk_message).
+ */
+struct ctr_vm_frame {
+	ctr_object* receiver;
+	ctr_object* result;
+	ctr_argument* arguments;
+	ctr_argument* argument;
+	int sticky;
+	int literal;
+	int level;
+	int chain;
+	ctr_size roots;
+};
+typedef struct ctr_vm_frame ctr_vm_frame;
+
+void ctr_vm_compile_expr(ctr_vm_compiler* c, ctr_tnode* node);
+ctr_bytecode* ctr_vm_compile_list(ctr_tnode* list);
+
+/**
+ * CTRCompilerEmit
+ *
+ * Appends an instruction and returns its offset.
+ */
+uint32_t ctr_vm_emit(ctr_vm_compiler* c, uint8_t opcode, uint8_t modifier, uint32_t operand) {
+	if (c->length == c->capacity) {
+		if (c->capacity) {
+			c->capacity *= 2;
+			c->instructions = ctr_heap_reallocate(c->instructions, c->capacity * sizeof(ctr_instruction));
+		} else {
+			c->capacity = 32;
+			c->instructions = ctr_heap_allocate(c->capacity * sizeof(ctr_instruction));
+		}
+	}
+	c->instructions[c->length].opcode = opcode;
+	c->instructions[c->length].modifier = modifier;
+	c->instructions[c->length].operand = operand;
+	c->instructions[c->length].jump = 0;
+	return c->length++;
+}
+
+/**
+ * CTRCompilerConstant
+ *
+ * Adds a node to the constant pool.
+ */
+uint32_t ctr_vm_constant(ctr_vm_compiler* c, ctr_tnode* node) {
+	if (c->constant_count == c->constant_capacity) {
+		if (c->constant_capacity) {
+			c->constant_capacity *= 2;
+			c->constants = ctr_heap_reallocate(c->constants, c->constant_capacity * sizeof(ctr_constant));
+		} else {
+			c->constant_capacity = 16;
+			c->constants = ctr_heap_allocate(c->constant_capacity * sizeof(ctr_constant));
+		}
+	}
+	c->constants[c->constant_count].node = node;
+	return c->constant_count++;
+}
+
+/**
+ * CTRCompilerPush
+ *
+ * Registers a value pushed on the stack of the machine.
+ */
+void ctr_vm_push(ctr_vm_compiler* c) {
+	c->depth++;
+	if (c->depth > c->stack_size) c->stack_size = c->depth;
+}
+
+/**
+ * CTRCompilerBlock
+ *
+ * Compiles the instruction list of a code block.
+ */
+void ctr_vm_compile_block(ctr_tnode* node) {
+	ctr_tnode* codeList;
+	if (!node->nodes || !node->nodes->next) return;
+	codeList = node->nodes->next->node;
+	if (codeList && !codeList->code) {
+		codeList->code = ctr_vm_compile_list(codeList);
+	}
+}
+
+/**
+ * CTRCompilerMessage
+ *
+ * Compiles a message expression: the receiver followed by a chain
+ * of messages and their arguments.
+ */
+void ctr_vm_compile_message(ctr_vm_compiler* c, ctr_tnode* node) {
+	ctr_tlistitem* li = node->nodes;
+	ctr_tlistitem* argument;
+	ctr_tnode* receiverNode;
+	uint32_t begin;
+	uint32_t recv;
+	uint32_t next;
+	uint32_t k;
+	if (!li || !li->node) {
+		c->failed = 1;
+		return;
+	}
+	receiverNode = li->node;
+	begin = ctr_vm_emit(c, CTR_OP_MSG_BEGIN, 0, 0);
+	c->frames++;
+	if (c->frames > c->frame_count) c->frame_count = c->frames;
+	recv = 0;
+	switch(receiverNode->type) {
+		case CTR_AST_NODE_REFERENCE:
+			recv = ctr_vm_emit(c, CTR_OP_RECV_REF, receiverNode->modifier, ctr_vm_constant(c, receiverNode));
+			break;
+		case CTR_AST_NODE_LTRSTRING:
+		case CTR_AST_NODE_LTRNUM:
+		case CTR_AST_NODE_NESTED:
+		case CTR_AST_NODE_CODEBLOCK:
+			ctr_vm_compile_expr(c, receiverNode);
+			ctr_vm_emit(c, CTR_OP_RECV, 0, 0);
+			c->depth--;
+			break;
+		default:
+			c->failed = 1;
+			return;
+	}
+	while(li->next) {
+		li = li->next;
+		if (!li->node) {
+			c->failed = 1;
+			return;
+		}
+		k = ctr_vm_constant(c, li->node);
+		next = ctr_vm_emit(c, CTR_OP_MSG_NEXT, 0, k);
+		argument = li->node->nodes;
+		while(argument) {
+			ctr_vm_emit(c, CTR_OP_ARG_BEGIN, 0, 0);
+			ctr_vm_compile_expr(c, argument->node);
+			ctr_vm_emit(c, CTR_OP_ARG_END, 0, 0);
+			c->depth--;
+			argument = argument->next;
+		}
+		ctr_vm_emit(c, CTR_OP_SEND, 0, k);
+		c->instructions[next].jump = c->length;
+	}
+	ctr_vm_emit(c, CTR_OP_MSG_END, 0, 0);
+	c->frames--;
+	ctr_vm_push(c);
+	c->instructions[begin].jump = c->length;
+	if (recv) c->instructions[recv].jump = c->length;
+}
+
+/**
+ * CTRCompilerExpression
+ *
+ * Compiles an expression, the resulting instructions leave exactly
+ * one value on the stack.
+ */
+void ctr_vm_compile_expr(ctr_vm_compiler* c, ctr_tnode* node) {
+	uint32_t begin;
+	ctr_tnode* assignee;
+	if (c->failed) return;
+	if (!node) {
+		c->failed = 1;
+		return;
+	}
+	switch (node->type) {
+		case CTR_AST_NODE_LTRSTRING:
+			ctr_vm_emit(c, CTR_OP_STRING, 0, ctr_vm_constant(c, node));
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_LTRNUM:
+			ctr_vm_emit(c, CTR_OP_NUMBER, 0, ctr_vm_constant(c, node));
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_LTRBOOLTRUE:
+			ctr_vm_emit(c, CTR_OP_TRUE, 0, 0);
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_LTRBOOLFALSE:
+			ctr_vm_emit(c, CTR_OP_FALSE, 0, 0);
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_LTRNIL:
+			ctr_vm_emit(c, CTR_OP_NIL, 0, 0);
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_CODEBLOCK:
+			ctr_vm_compile_block(node);
+			ctr_vm_emit(c, CTR_OP_BLOCK, 0, ctr_vm_constant(c, node));
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_REFERENCE:
+			ctr_vm_emit(c, CTR_OP_REFERENCE, node->modifier, ctr_vm_constant(c, node));
+			ctr_vm_push(c);
+			break;
+		case CTR_AST_NODE_EXPRMESSAGE:
+			ctr_vm_compile_message(c, node);
+			break;
+		case CTR_AST_NODE_EXPRASSIGNMENT:
+			if (!node->nodes || !node->nodes->next) {
+				c->failed = 1;
+				return;
+			}
+			assignee = node->nodes->node;
+			begin = ctr_vm_emit(c, CTR_OP_ASSIGN_BEGIN, 0, ctr_vm_constant(c, assignee));
+			ctr_vm_compile_expr(c, node->nodes->next->node);
+			ctr_vm_emit(c, CTR_OP_ASSIGN, assignee->modifier, c->instructions[begin].operand);
+			c->instructions[begin].jump = c->length;
+			break;
+		case CTR_AST_NODE_NESTED:
+			if (!node->nodes) {
+				c->failed = 1;
+				return;
+			}
+			ctr_vm_compile_expr(c, node->nodes->node);
+			break;
+		case CTR_AST_NODE_ENDOFPROGRAM:
+			ctr_vm_emit(c, CTR_OP_WALK, 0, ctr_vm_constant(c, node));
+			ctr_vm_push(c);
+			break;
+		default:
+			c->failed = 1;
+			break;
+	}
+}
+
+/**
+ * CTRCompilerFinish
+ *
+ * Copies the instructions and the constant pool into a single
+ * tracked memory block and releases the compiler buffers.
+ */
+ctr_bytecode* ctr_vm_finish(ctr_vm_compiler* c) {
+	ctr_bytecode* code = NULL;
+	char* block;
+	size_t isize = c->length * sizeof(ctr_instruction);
+	size_t csize = c->constant_count * sizeof(ctr_constant);
+	if (!c->failed) {
+		block = ctr_heap_allocate_tracked(sizeof(ctr_bytecode) + isize + csize);
+		code = (ctr_bytecode*) block;
+		code->instructions = (ctr_instruction*) (block + sizeof(ctr_bytecode));
+		code->constants = (ctr_constant*) (block + sizeof(ctr_bytecode) + isize);
+		memcpy(code->instructions, c->instructions, isize);
+		if (csize) memcpy(code->constants, c->constants, csize);
+		code->length = c->length;
+		code->constant_count = c->constant_count;
+		code->stack_size = c->stack_size ? c->stack_size : 1;
+		code->frame_count = c->frame_count ? c->frame_count : 1;
+	}
+	if (c->instructions) ctr_heap_free(c->instructions);
+	if (c->constants) ctr_heap_free(c->constants);
+	return code;
+}
+
+/**
+ * CTRCompilerList
+ *
+ * Compiles a list of statements (a program or the code of a block).
+ * Returns NULL if the list contains a node the compiler does not know,
+ * in that case the walker will run the list.
+ */
+ctr_bytecode* ctr_vm_compile_list(ctr_tnode* list) {
+	ctr_vm_compiler compiler;
+	ctr_vm_compiler* c = &compiler;
+	ctr_tlistitem* li = list->nodes;
+	ctr_tnode* node;
+	memset(c, 0, sizeof(ctr_vm_compiler));
+	while(li && !c->failed) {
+		node = li->node;
+		if (!node) {
+			c->failed = 1;
+			break;
+		}
+		if (node->type == CTR_AST_NODE_RETURNFROMBLOCK) {
+			if (!node->nodes || !node->nodes->node) {
+				c->failed = 1;
+				break;
+			}
+			ctr_vm_compile_expr(c, node->nodes->node);
+			ctr_vm_emit(c, CTR_OP_RETURN, 0, 0);
+		} else {
+			ctr_vm_compile_expr(c, node);
+			ctr_vm_emit(c, CTR_OP_STATEMENT, (li->next != NULL), 0);
+		}
+		c->depth = 0;
+		li = li->next;
+	}
+	ctr_vm_emit(c, CTR_OP_HALT, 0, 0);
+	return ctr_vm_finish(c);
+}
+
+/**
+ * CTRCompilerProgram
+ *
+ * Compiles a parsed program and all of its code blocks.
+ */
+void ctr_vm_compile_program(ctr_tnode* program) {
+	program->code = ctr_vm_compile_list(program);
+}
+
+/**
+ * CTRCompilerExpressionOnly
+ *
+ * Compiles a single expression (used by string evaluation),
+ * running the resulting code returns the value of the expression.
+ */
+ctr_bytecode* ctr_vm_compile_expression(ctr_tnode* node) {
+	ctr_vm_compiler compiler;
+	ctr_vm_compiler* c = &compiler;
+	memset(c, 0, sizeof(ctr_vm_compiler));
+	ctr_vm_compile_expr(c, node);
+	ctr_vm_emit(c, CTR_OP_RETURN, 0, 0);
+	return ctr_vm_finish(c);
+}
+
+/**
+ * CTRVirtualMachineRun
+ *
+ * Runs a compiled instruction list. The machine performs exactly the
+ * same steps as the walker (flow checks, call stack, pinning of
+ * receivers and arguments, garbage collection after each statement)
+ * but without chasing node lists and without recursion for nested
+ * expressions. Like ctr_cwlk_run it returns the value of a return
+ * statement or NULL.
+ */
+ctr_object* ctr_vm_run(ctr_bytecode* code) {
+	ctr_object* stack[code->stack_size];
+	ctr_vm_frame frames[code->frame_count];
+	ctr_object** sp = stack;
+	ctr_vm_frame* f = frames - 1;
+	ctr_instruction* pc = code->instructions;
+	ctr_instruction* instruction;
+	ctr_constant* constants = code->constants;
+	ctr_tnode* node;
+	ctr_object* r;
+	ctr_object* result;
+	ctr_argument* a;
+	ctr_argument* aItem;
+	char wasReturn;
+	while(1) {
+		instruction = pc++;
+		switch(instruction->opcode) {
+			case CTR_OP_STRING:
+			case CTR_OP_NUMBER:
+				*sp++ = ctr_internal_constant(constants[instruction->operand].node);
+				break;
+			case CTR_OP_BLOCK:
+				*sp++ = ctr_build_block(constants[instruction->operand].node);
+				break;
+			case CTR_OP_TRUE:
+				*sp++ = CtrStdBoolTrue;
+				break;
+			case CTR_OP_FALSE:
+				*sp++ = CtrStdBoolFalse;
+				break;
+			case CTR_OP_NIL:
+				*sp++ = ctr_build_nil();
+				break;
+			case CTR_OP_REFERENCE:
+				result = CtrStdNil;
+				if (CTR_VM_FLOW_OK) {
+					node = constants[instruction->operand].node;
+					ctr_callstack[ctr_callstack_index++] = node;
+					if (instruction->modifier == 1) {
+						result = ctr_find_in_my(node->symbol);
+					} else {
+						result = ctr_find_variable(node);
+					}
+					if (CTR_VM_FLOW_OK) {
+						ctr_callstack_index--;
+					} else {
+						errstack++;
+					}
+				}
+				*sp++ = result;
+				break;
+			case CTR_OP_ASSIGN_BEGIN:
+				if (!CTR_VM_FLOW_OK) {
+					*sp++ = CtrStdNil;
+					pc = code->instructions + instruction->jump;
+					break;
+				}
+				ctr_callstack[ctr_callstack_index++] = constants[instruction->operand].node;
+				break;
+			case CTR_OP_ASSIGN:
+				node = constants[instruction->operand].node;
+				r = *--sp;
+				if (instruction->modifier == 1) {
+					result = ctr_assign_value_to_my(node->symbol, r);
+				} else if (instruction->modifier == 2) {
+					result = ctr_assign_local_variable(node, r);
+				} else {
+					result = ctr_assign_variable(node, r);
+				}
+				if (CTR_VM_FLOW_OK) {
+					ctr_callstack_index--;
+				} else {
+					errstack++;
+				}
+				*sp++ = result;
+				break;
+			case CTR_OP_MSG_BEGIN:
+				if (!CTR_VM_FLOW_OK) {
+					*sp++ = CtrStdNil;
+					pc = code->instructions + instruction->jump;
+					break;
+				}
+				f++;
+				f->receiver = NULL;
+				f->result = CtrStdNil;
+				f->literal = 1;
+				f->chain = 0;
+				break;
+			case CTR_OP_RECV_REF:
+				f->literal = 0;
+				node = constants[instruction->operand].node;
+				ctr_callstack[ctr_callstack_index++] = node;
+				if (instruction->modifier == 1) {
+					r = ctr_find_in_my(node->symbol);
+				} else {
+					r = ctr_find_variable(node);
+				}
+				if (CTR_VM_FLOW_OK) {
+					ctr_callstack_index--;
+				} else {
+					errstack++;
+					f--;
+					*sp++ = CtrStdNil;
+					pc = code->instructions + instruction->jump;
+					break;
+				}
+				if (!r) {
+					fprintf(stderr, "Invalid state");
+					exit(1);
+				}
+				f->receiver = r;
+				f->level = ctr_in_message;
+				break;
+			case CTR_OP_RECV:
+				f->receiver = *--sp;
+				f->level = ctr_in_message;
+				break;
+			case CTR_OP_MSG_NEXT:
+				if (f->chain) {
+					ctr_in_message++;
+				}
+				f->chain++;
+				if (!CTR_VM_FLOW_OK) {
+					pc = code->instructions + instruction->jump;
+					break;
+				}
+				ctr_callstack[ctr_callstack_index++] = constants[instruction->operand].node;
+				a = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+				a->object = CtrStdNil;
+				f->arguments = a;
+				f->argument = a;
+				r = f->receiver;
+				f->sticky = r->info.sticky;
+				r->info.sticky = 1;
+				f->roots = ctr_gc_internal_roots();
+				if (f->literal) {
+					ctr_gc_internal_pin(r);
+				}
+				break;
+			case CTR_OP_ARG_BEGIN:
+				ctr_in_message++;
+				break;
+			case CTR_OP_ARG_END:
+				ctr_in_message--;
+				r = *--sp;
+				f->argument->object = r;
+				ctr_gc_internal_pin(r);
+				f->argument->next = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
+				f->argument = f->argument->next;
+				f->argument->object = CtrStdNil;
+				break;
+			case CTR_OP_SEND:
+				node = constants[instruction->operand].node;
+				f->argument->next = NULL;
+				r = f->receiver;
+				result = ctr_send_message_symbol(r, node->symbol, f->arguments, node->cache);
+				r->info.sticky = f->sticky;
+				if (CTR_VM_FLOW_OK) {
+					ctr_callstack_index --;
+				} else {
+					errstack++;
+				}
+				aItem = f->arguments;
+				while(aItem->next) {
+					a = aItem;
+					aItem = aItem->next;
+					ctr_heap_free( a );
+				}
+				ctr_heap_free( aItem );
+				ctr_gc_internal_unpin(f->roots);
+				f->receiver = result;
+				f->result = result;
+				f->literal = 1;
+				break;
+			case CTR_OP_MSG_END:
+				ctr_in_message -= (f->chain - 1);
+				if (ctr_in_message != f->level) {
+					printf( CTR_ERR_ANOMALY );
+					exit(1);
+				}
+				*sp++ = f->result;
+				f--;
+				break;
+			case CTR_OP_WALK:
+				wasReturn = 0;
+				*sp++ = ctr_cwlk_expr(constants[instruction->operand].node, &wasReturn);
+				break;
+			case CTR_OP_STATEMENT:
+				sp--;
+				ctr_gc_cycle();
+				#ifdef __EMSCRIPTEN__
+				if (instruction->modifier) emscripten_sleep(1);
+				#endif
+				break;
+			case CTR_OP_RETURN:
+				return *--sp;
+			case CTR_OP_HALT:
+				return NULL;
+			default:
+				fprintf(stderr, CTR_ERR_NODE, instruction->opcode, "?");
+				exit(1);
+		}
+	}
+}
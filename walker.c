@@ -8,6 +8,18 @@ ctr_tnode* ctr_callstack[301];
 uint8_t ctr_callstack_index;
 
 
+/**
+ * CTRWalkerSourceLine
+ *
+ * Returns the line (0-based) of a node and the program it belongs to.
+ * Returns -1 if the position of the node is unknown.
+ */
+int ctr_cwlk_source_line(ctr_tnode* node, char** program) {
+	if (node->line == 0 || node->program == NULL) return -1;
+	*program = node->program;
+	return (int) node->line - 1;
+}
+
 /**
  * CTRWalkerReturn
  *
@@ -40,37 +52,30 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 	int sticky = 0;
 	char wasReturn = 0;
 	int literal = 1;
-	int MAX_KEYS = 40;
-	ctr_object* keys[MAX_KEYS];
-	int key_index = 0;
+	ctr_size roots;
 	ctr_object* result;
 	ctr_tlistitem* eitem = paramNode->nodes;
 	ctr_tnode* receiverNode = eitem->node;
 	ctr_tnode* msgnode;
 	ctr_tlistitem* li = eitem;
-	char* message;
 	ctr_tlistitem* argumentList;
 	ctr_object* r = NULL;
-	ctr_object* recipientName = NULL;
 	result = CtrStdNil;
 	if (CtrStdFlow != NULL && CtrStdFlow != CtrStdContinue && CtrStdFlow != CtrStdBreak) return result;
 	switch (receiverNode->type) {
 		case CTR_AST_NODE_REFERENCE:
 			literal = 0;
 			if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
-				recipientName = ctr_build_string(receiverNode->value, receiverNode->vlen);
-				recipientName->info.sticky = 1;
 				ctr_callstack[ctr_callstack_index++] = receiverNode;
 				if (receiverNode->modifier == 1) {
-					r = ctr_find_in_my(recipientName);
+					r = ctr_find_in_my(receiverNode->symbol);
 				} else {
-					r = ctr_find(recipientName);
+					r = ctr_find_variable(receiverNode);
 				}
 				if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
 					ctr_callstack_index--;
 				} else {
 					errstack++;
-					recipientName->info.sticky = 0;
 					return CtrStdNil;
 				}
 				if (!r) {
@@ -80,10 +85,10 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 			}
 			break;
 		case CTR_AST_NODE_LTRSTRING:
-			r = ctr_build_string(receiverNode->value, receiverNode->vlen);
+			r = ctr_internal_constant(receiverNode);
 			break;
 		case CTR_AST_NODE_LTRNUM:
-			r = ctr_build_number_from_string(receiverNode->value, receiverNode->vlen, 0);
+			r = ctr_internal_constant(receiverNode);
 			break;
 		case CTR_AST_NODE_NESTED:
 			r = ctr_cwlk_expr(receiverNode, &wasReturn);
@@ -104,11 +109,8 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 		ctr_is_chain++;
 		ctr_argument* a;
 		ctr_argument* aItem;
-		ctr_size l;
 		li = li->next;
 		msgnode = li->node;
-		message = msgnode->value;
-		l = msgnode->vlen;
 		if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
 			ctr_callstack[ctr_callstack_index++] = msgnode;
 			argumentList = msgnode->nodes;
@@ -117,12 +119,9 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 			aItem->object = CtrStdNil;
 			sticky = r->info.sticky;
 			r->info.sticky = 1;
+			roots = ctr_gc_internal_roots();
 			if (literal) {
-				keys[key_index++] = ctr_gc_internal_pin(r);
-				if (key_index >= MAX_KEYS) {
-					printf( CTR_ERR_KEYINX );
-					exit(1);
-				}
+				ctr_gc_internal_pin(r);
 			}
 			if (argumentList) {
 				ctr_tnode* node;
@@ -132,11 +131,7 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 					ctr_object* o = ctr_cwlk_expr(node, &wasReturn);
 					ctr_in_message--;
 					aItem->object = o;
-					keys[key_index++] = ctr_gc_internal_pin(o);
-					if (key_index >= MAX_KEYS) {
-						printf( CTR_ERR_KEYINX );
-						exit(1);
-					}
+					ctr_gc_internal_pin(o);
 					/* we always send at least one argument, note that if you want to modify the argumentList, be sure to take this into account */
 					/* there is always an extra empty argument at the end */
 					aItem->next = (ctr_argument*) ctr_heap_allocate( sizeof( ctr_argument ) );
@@ -148,7 +143,7 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 				}
 			}
 			aItem->next = NULL; // just be sure set final next to NULL
-			result = ctr_send_message(r, message, l, a);
+			result = ctr_send_message_symbol(r, msgnode->symbol, a, msgnode->cache);
 			r->info.sticky = sticky;
 			aItem = a;
 			if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
@@ -159,13 +154,10 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 			while(aItem->next) {
 				a = aItem;
 				aItem = aItem->next;
-				ctr_internal_object_delete_property(ctr_contexts[ctr_context_id], keys[--key_index], CTR_CATEGORY_PRIVATE_PROPERTY);
 				ctr_heap_free( a );
 			}
 			ctr_heap_free( aItem );
-			if (literal) {
-				ctr_internal_object_delete_property( ctr_contexts[ctr_context_id], keys[--key_index], CTR_CATEGORY_PRIVATE_PROPERTY );
-			}
+			ctr_gc_internal_unpin(roots);
 			r = result;
 			literal = 1; //treat as literal because not yet protected against gc
 		}
@@ -175,7 +167,6 @@ ctr_object* ctr_cwlk_message(ctr_tnode* paramNode) {
 		printf( CTR_ERR_ANOMALY );
 		exit(1);
 	}
-	if (recipientName) recipientName->info.sticky = 0;
 	return result;
 }	
 
@@ -196,11 +187,11 @@ ctr_object* ctr_cwlk_assignment(ctr_tnode* node) {
 		ctr_callstack[ctr_callstack_index++] = assignee;
 		x = ctr_cwlk_expr(value, &wasReturn);
 		if (assignee->modifier == 1) {
-			result = ctr_assign_value_to_my(ctr_build_string(assignee->value, assignee->vlen), x);
+			result = ctr_assign_value_to_my(assignee->symbol, x);
 		} else if (assignee->modifier == 2) {
-			result = ctr_assign_value_to_local(ctr_build_string(assignee->value, assignee->vlen), x);
+			result = ctr_assign_local_variable(assignee, x);
 		} else {
-			result = ctr_assign_value(ctr_build_string(assignee->value, assignee->vlen), x);
+			result = ctr_assign_variable(assignee, x);
 		}
 		if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
 			ctr_callstack_index--;
@@ -220,13 +211,12 @@ ctr_object* ctr_cwlk_expr(ctr_tnode* node, char* wasReturn) {
 	ctr_object* result;
 	uint8_t i;
 	int line;
-	char* currentProgram = "?";
+	char* currentProgram;
 	ctr_tnode* stackNode;
-	ctr_source_map* mapItem;
 	result = CtrStdNil;
 	switch (node->type) {
 		case CTR_AST_NODE_LTRSTRING:
-			result = ctr_build_string(node->value, node->vlen);
+			result = ctr_internal_constant(node);
 			break;
 		case CTR_AST_NODE_LTRBOOLTRUE:
 			result = CtrStdBoolTrue;
@@ -238,7 +228,7 @@ ctr_object* ctr_cwlk_expr(ctr_tnode* node, char* wasReturn) {
 			result = ctr_build_nil();
 			break;
 		case CTR_AST_NODE_LTRNUM:
-			result = ctr_build_number_from_string(node->value, node->vlen, 0);
+			result = ctr_internal_constant(node);
 			break;
 		case CTR_AST_NODE_CODEBLOCK:
 			result = ctr_build_block(node);
@@ -247,9 +237,9 @@ ctr_object* ctr_cwlk_expr(ctr_tnode* node, char* wasReturn) {
 			if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
 				ctr_callstack[ctr_callstack_index++] = node;
 				if (node->modifier == 1) {
-					result = ctr_find_in_my(ctr_build_string(node->value, node->vlen));
+					result = ctr_find_in_my(node->symbol);
 				} else {
-					result = ctr_find(ctr_build_string(node->value, node->vlen));
+					result = ctr_find_variable(node);
 				}
 				if (CtrStdFlow == NULL || CtrStdFlow == CtrStdContinue || CtrStdFlow == CtrStdBreak) {
 					ctr_callstack_index--;
@@ -283,18 +273,9 @@ ctr_object* ctr_cwlk_expr(ctr_tnode* node, char* wasReturn) {
 					fprintf(stderr,"#%d ", i);
 					stackNode = ctr_callstack[i-1];
 					fwrite(stackNode->value, sizeof(char), stackNode->vlen, stderr);
-					mapItem = ctr_source_map_head;
-					line = -1;
-					while(mapItem) {
-						if (line == -1 && mapItem->node == stackNode) {
-							line = mapItem->line;
-						}
-						if (line > -1 && mapItem->node->type == CTR_AST_NODE_PROGRAM) {
-							currentProgram = mapItem->node->value;
-							fprintf(stderr," (%s: %d)", currentProgram, line+1);
-							break;
-						}
-						mapItem = mapItem->next;
+					line = ctr_cwlk_source_line(stackNode, &currentProgram);
+					if (line > -1) {
+						fprintf(stderr," (%s: %d)", currentProgram, line+1);
 					}
 					fprintf(stderr,"\n");
 				}
@@ -318,6 +299,9 @@ ctr_object* ctr_cwlk_run(ctr_tnode* program) {
 	ctr_object* result = NULL;
 	char wasReturn = 0;
 	ctr_tlistitem* li;
+	if (program->code) {
+		return ctr_vm_run(program->code);
+	}
 	li = program->nodes;
 	while(li) {
 		ctr_tnode* node = li->node;
@@ -1,4 +1,7 @@
 #include "citrine.h"
+#ifdef CTR_MEMMEM_X86
+#include <immintrin.h>
+#endif
 
 ctr_object* CtrStdWorld;
 ctr_object* CtrStdObject;
@@ -10,6 +13,7 @@ ctr_object* CtrStdConsole;
 ctr_object* CtrStdNil;
 ctr_object* CtrStdGC;
 ctr_object* CtrStdMap;
+ctr_object* CtrStdBuffer;
 ctr_object* CtrStdArray;
 ctr_object* CtrStdFile;
 ctr_object* CtrStdSystem;
@@ -20,19 +24,34 @@ ctr_object* CtrStdBreak;
 ctr_object* CtrStdContinue;
 ctr_object* CtrStdExit;
 ctr_object* ctr_first_object;
+ctr_object* ctr_first_young;
 ctr_object* CtrStdBoolTrue;
 ctr_object* CtrStdBoolFalse;
 ctr_object* CtrStdSlurp;
 ctr_object* CtrStdPath;
 ctr_object* CtrStdShellCommand;
+ctr_object* CtrSymbolMe;
+ctr_object* CtrSymbolMy;
+ctr_object* CtrSymbolCurrentTask;
 int ctr_message_stack_index = 0;
 ctr_object* ctr_message_stack[301];
 
 char CtrHashKey[16];
 
 ctr_object* ctr_contexts[301];
+ctr_size ctr_context_roots[301];
 int ctr_context_id;
 
+/* slots of the open contexts, every context has a frame of scope->count slots */
+ctr_scope* ctr_context_scope[301];
+ctr_size ctr_context_frame[301];
+ctr_object** ctr_slots = NULL;
+ctr_size ctr_slots_count = 0;
+ctr_size ctr_slots_capacity = 0;
+
+/* incremented whenever a method table changes, invalidates inline caches */
+uint64_t ctr_method_epoch = 1;
+
 char ctr_deserialize_mode;
 ctr_object* ctr_internal_recursion;
 
@@ -85,6 +104,7 @@ int ctr_internal_object_is_equal(ctr_object* object1, ctr_object* object2) {
 	ctr_size len2;
 	ctr_size d;
 	if (object1->info.type == CTR_OBJECT_TYPE_OTSTRING && object2->info.type == CTR_OBJECT_TYPE_OTSTRING) {
+		if (object1 == object2) return 1;
 		string1 = object1->value.svalue->value;
 		string2 = object2->value.svalue->value;
 		len1 = object1->value.svalue->vlen;
@@ -119,10 +139,144 @@ int ctr_internal_object_is_equal(ctr_object* object1, ctr_object* object2) {
  * lookup.
  */
 uint64_t ctr_internal_index_hash(ctr_object* key) {
-	ctr_object* stringKey = ctr_internal_cast2string(key);
+	ctr_object* stringKey;
+	if (key->info.symbol) {
+		return ((ctr_symbol*) key)->hash;
+	}
+	stringKey = ctr_internal_cast2string(key);
 	return siphash24(stringKey->value.svalue->value, stringKey->value.svalue->vlen, CtrHashKey);
 }
 
+/**
+ * ?internal
+ *
+ * MapIndex
+ *
+ * Small maps are searched by scanning their items, once a map grows
+ * beyond CTR_MAP_INDEX_THRESHOLD items an open addressing table
+ * (linear probing) is added that points to the newest item for every
+ * key. The linked list of items remains the authority on order,
+ * so iteration is not affected by the index.
+ */
+ctr_mapitem ctr_map_tombstone;
+
+ctr_mapitem** ctr_internal_map_slot(ctr_map* map, ctr_object* key, uint64_t hashKey) {
+	ctr_size mask = map->capacity - 1;
+	ctr_size i = hashKey & mask;
+	ctr_mapitem* item;
+	while((item = map->index[i])) {
+		if (item != &ctr_map_tombstone && hashKey == item->hashKey && ctr_internal_object_is_equal(item->key, key)) {
+			return &map->index[i];
+		}
+		i = (i + 1) & mask;
+	}
+	return NULL;
+}
+
+void ctr_internal_map_index_insert(ctr_map* map, ctr_mapitem* newItem) {
+	ctr_size mask = map->capacity - 1;
+	ctr_size i = newItem->hashKey & mask;
+	ctr_mapitem** free_slot = NULL;
+	ctr_mapitem* item;
+	while((item = map->index[i])) {
+		if (item == &ctr_map_tombstone) {
+			if (!free_slot) free_slot = &map->index[i];
+		} else if (newItem->hashKey == item->hashKey && ctr_internal_object_is_equal(item->key, newItem->key)) {
+			/* newer item with same key shadows the older one */
+			map->index[i] = newItem;
+			map->shadowed++;
+			return;
+		}
+		i = (i + 1) & mask;
+	}
+	if (!free_slot) {
+		free_slot = &map->index[i];
+		map->used++;
+	}
+	*free_slot = newItem;
+}
+
+void ctr_internal_map_index_rebuild(ctr_map* map) {
+	ctr_mapitem* item;
+	ctr_size capacity = CTR_MAP_INDEX_THRESHOLD * 4;
+	while(capacity < map->size * 4) capacity *= 2;
+	if (map->index) ctr_heap_free(map->index);
+	map->index = ctr_heap_allocate(capacity * sizeof(ctr_mapitem*));
+	map->capacity = capacity;
+	map->used = 0;
+	map->shadowed = 0;
+	/* insert oldest first so newer items shadow older ones */
+	item = map->tail;
+	while(item) {
+		ctr_internal_map_index_insert(map, item);
+		item = item->prev;
+	}
+}
+
+/**
+ * ?internal
+ *
+ * MapFindKey
+ *
+ * Finds the newest item with a string key consisting of the
+ * specified bytes, the hash must be the siphash of those bytes.
+ * Allows lookups without building a key object.
+ */
+ctr_mapitem* ctr_internal_map_find_key(ctr_map* map, char* key, ctr_size length, uint64_t hashKey) {
+	ctr_size mask;
+	ctr_size i;
+	ctr_mapitem* item;
+	if (map == NULL || map->size == 0) return NULL;
+	if (map->index) {
+		mask = map->capacity - 1;
+		i = hashKey & mask;
+		while((item = map->index[i])) {
+			if (item != &ctr_map_tombstone && hashKey == item->hashKey
+			&& item->key->info.type == CTR_OBJECT_TYPE_OTSTRING
+			&& item->key->value.svalue->vlen == length
+			&& memcmp(item->key->value.svalue->value, key, length) == 0) {
+				return item;
+			}
+			i = (i + 1) & mask;
+		}
+		return NULL;
+	}
+	item = map->head;
+	while(item) {
+		if (hashKey == item->hashKey
+		&& item->key->info.type == CTR_OBJECT_TYPE_OTSTRING
+		&& item->key->value.svalue->vlen == length
+		&& memcmp(item->key->value.svalue->value, key, length) == 0) {
+			return item;
+		}
+		item = item->next;
+	}
+	return NULL;
+}
+
+/**
+ * ?internal
+ *
+ * MapPromote
+ *
+ * Moves an item to the front of the map, where newly added items go,
+ * as if it had been removed and added again.
+ */
+void ctr_internal_map_promote(ctr_map* map, ctr_mapitem* item) {
+	map->modifications++;
+	if (map->head == item) return;
+	item->prev->next = item->next;
+	if (item->next) {
+		item->next->prev = item->prev;
+	} else {
+		map->tail = item->prev;
+	}
+	item->prev = NULL;
+	item->next = map->head;
+	map->head->prev = item;
+	map->head = item;
+}
+
 /**
  * ?internal
  *
@@ -132,19 +286,18 @@ uint64_t ctr_internal_index_hash(ctr_object* key) {
  */
 ctr_object* ctr_internal_object_find_property(ctr_object* owner, ctr_object* key, int is_method) {
 	ctr_mapitem* head;
+	ctr_mapitem** slot;
+	ctr_map* map;
 	uint64_t hashKey = ctr_internal_index_hash(key);
-
-	if (is_method) {
-		if (owner->methods->size == 0) {
-			return NULL;
-		}
-		head = owner->methods->head;
-	} else {
-		if (owner->properties->size == 0) {
-			return NULL;
-		}
-		head = owner->properties->head;
+	map = is_method ? owner->methods : owner->properties;
+	if (map == NULL || map->size == 0) {
+		return NULL;
+	}
+	if (map->index) {
+		slot = ctr_internal_map_slot(map, key, hashKey);
+		return slot ? (*slot)->value : NULL;
 	}
+	head = map->head;
 	while(head) {
 		if ((hashKey == head->hashKey) && ctr_internal_object_is_equal(head->key, key)) {
 			return head->value;
@@ -164,56 +317,63 @@ ctr_object* ctr_internal_object_find_property(ctr_object* owner, ctr_object* key
  */
 void ctr_internal_object_delete_property(ctr_object* owner, ctr_object* key, int is_method) {
 	uint64_t hashKey = ctr_internal_index_hash(key);
-	ctr_mapitem* head;
+	ctr_mapitem* head = NULL;
+	ctr_mapitem* older;
+	ctr_mapitem** slot = NULL;
+	ctr_map* map;
+	map = is_method ? owner->methods : owner->properties;
+	if (map == NULL || map->size == 0) {
+		return;
+	}
 	if (is_method) {
-		if (owner->methods->size == 0) {
-			return;
-		}
-		head = owner->methods->head;
+		ctr_method_epoch++;
+	}
+	if (map->index) {
+		slot = ctr_internal_map_slot(map, key, hashKey);
+		if (slot) head = *slot;
 	} else {
-		if (owner->properties->size == 0) {
-			return;
+		head = map->head;
+		while(head) {
+			if ((hashKey == head->hashKey) && ctr_internal_object_is_equal(head->key, key)) break;
+			head = head->next;
 		}
-		head = owner->properties->head;
 	}
-	while(head) {
-		if ((hashKey == head->hashKey) && ctr_internal_object_is_equal(head->key, key)) {
-			if (head->next && head->prev) {
-				head->next->prev = head->prev;
-				head->prev->next = head->next;
-			} else {
-				if (head->next) {
-					head->next->prev = NULL;
-				}
-				if (head->prev) {
-					head->prev->next = NULL;
-				}
-			}
-			if (is_method) {
-				if (owner->methods->head == head) {
-					if (head->next) {
-						owner->methods->head = head->next;
-					} else {
-						owner->methods->head = NULL;
-					}
-				}
-				owner->methods->size --;
-			} else {
-				if (owner->properties->head == head) {
-					if (head->next) {
-						owner->properties->head = head->next;
-					} else {
-						owner->properties->head = NULL;
-					}
+	if (!head) return;
+	if (slot) {
+		*slot = &ctr_map_tombstone;
+		if (map->shadowed) {
+			/* the next older item with the same key becomes visible again */
+			older = head->next;
+			while(older) {
+				if ((hashKey == older->hashKey) && ctr_internal_object_is_equal(older->key, key)) {
+					*slot = older;
+					map->shadowed--;
+					break;
 				}
-				owner->properties->size --;
+				older = older->next;
 			}
-			ctr_heap_free( head );
-			return;
 		}
-		head = head->next;
 	}
-	return;
+	if (head->next) {
+		head->next->prev = head->prev;
+	} else {
+		map->tail = head->prev;
+	}
+	if (head->prev) {
+		head->prev->next = head->next;
+	} else {
+		map->head = head->next;
+	}
+	map->size --;
+	map->modifications++;
+	if (map->size == 0 && map->index) {
+		ctr_heap_free(map->index);
+		map->index = NULL;
+		map->capacity = 0;
+		map->used = 0;
+		map->shadowed = 0;
+	}
+	ctr_heap_free( head );
 }
 
 /**
@@ -225,32 +385,42 @@ void ctr_internal_object_delete_property(ctr_object* owner, ctr_object* key, int
  */
 void ctr_internal_object_add_property(ctr_object* owner, ctr_object* key, ctr_object* value, int m) {
 	ctr_mapitem* new_item = ctr_heap_allocate(sizeof(ctr_mapitem));
-	ctr_mapitem* current_head = NULL;
+	ctr_map* map;
+	key = ctr_internal_constant_clone(key);
+	value = ctr_internal_constant_clone(value);
+	ctr_gc_write_barrier(owner, key);
+	ctr_gc_write_barrier(owner, value);
 	new_item->key = key;
 	new_item->hashKey = ctr_internal_index_hash(key);
 	new_item->value = value;
 	new_item->next = NULL;
 	new_item->prev = NULL;
 	if (m) {
-		if (owner->methods->size == 0) {
-			owner->methods->head = new_item;
-		} else {
-			current_head = owner->methods->head;
-			current_head->prev = new_item;
-			new_item->next = current_head;
-			owner->methods->head = new_item;
-		}
-		owner->methods->size ++;
+		ctr_method_epoch++;
+		if (owner->methods == NULL) owner->methods = ctr_heap_allocate(sizeof(ctr_map));
+		map = owner->methods;
+	} else {
+		if (owner->properties == NULL) owner->properties = ctr_heap_allocate(sizeof(ctr_map));
+		map = owner->properties;
+	}
+	if (map->size == 0) {
+		map->head = new_item;
+		map->tail = new_item;
 	} else {
-		if (owner->properties->size == 0) {
-			owner->properties->head = new_item;
+		map->head->prev = new_item;
+		new_item->next = map->head;
+		map->head = new_item;
+	}
+	map->size ++;
+	map->modifications++;
+	if (map->index) {
+		if ((map->used + 1) * 2 > map->capacity) {
+			ctr_internal_map_index_rebuild(map);
 		} else {
-			current_head = owner->properties->head;
-			current_head->prev = new_item;
-			new_item->next = current_head;
-			owner->properties->head = new_item;
+			ctr_internal_map_index_insert(map, new_item);
 		}
-		owner->properties->size ++;
+	} else if (map->size > CTR_MAP_INDEX_THRESHOLD) {
+		ctr_internal_map_index_rebuild(map);
 	}
 }
 
@@ -329,11 +499,12 @@ char ctr_tobool(ctr_object* o) {
 /**
  * ?internal
  *
- * InternalMemMem
+ * InternalMemMemScalar
  *
- * memmem implementation because this not available on every system.
+ * Portable substring search, compares the needle at every position.
+ * Also serves as the reference for the vectorized versions.
  */
-char* ctr_internal_memmem(char* haystack, long hlen, char* needle, long nlen, int reverse ) {
+char* ctr_internal_memmem_scalar(char* haystack, long hlen, char* needle, long nlen, int reverse ) {
 	char* cur;
 	char* last;
 	char* begin;
@@ -354,6 +525,259 @@ char* ctr_internal_memmem(char* haystack, long hlen, char* needle, long nlen, in
 	return NULL;
 }
 
+#ifdef CTR_MEMMEM_X86
+
+/**
+ * ?internal
+ *
+ * InternalMemMemSSE2
+ *
+ * Vectorized substring search (first and last byte filter):
+ * compares 16 positions at once with the first and the last byte
+ * of the needle, only the positions where both match are verified
+ * with memcmp. The remaining positions are searched by the scalar
+ * version.
+ */
+__attribute__((target("sse2")))
+char* ctr_internal_memmem_sse2(char* haystack, long hlen, char* needle, long nlen, int reverse ) {
+	__m128i first = _mm_set1_epi8(needle[0]);
+	__m128i last = _mm_set1_epi8(needle[nlen - 1]);
+	__m128i a, b;
+	unsigned int mask;
+	long i;
+	int bit;
+	if (!reverse) {
+		for(i = 0; i + nlen + 15 <= hlen; i += 16) {
+			a = _mm_loadu_si128((__m128i*) (haystack + i));
+			b = _mm_loadu_si128((__m128i*) (haystack + i + nlen - 1));
+			mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+			while(mask) {
+				bit = __builtin_ctz(mask);
+				if (nlen < 3 || memcmp(haystack + i + bit + 1, needle + 1, nlen - 2) == 0) return haystack + i + bit;
+				mask &= mask - 1;
+			}
+		}
+		return ctr_internal_memmem_scalar(haystack + i, hlen - i, needle, nlen, 0);
+	}
+	for(i = hlen - nlen - 15; i >= 0; i -= 16) {
+		a = _mm_loadu_si128((__m128i*) (haystack + i));
+		b = _mm_loadu_si128((__m128i*) (haystack + i + nlen - 1));
+		mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+		while(mask) {
+			bit = 31 - __builtin_clz(mask);
+			if (nlen < 3 || memcmp(haystack + i + bit + 1, needle + 1, nlen - 2) == 0) return haystack + i + bit;
+			mask &= ~(1u << bit);
+		}
+	}
+	return ctr_internal_memmem_scalar(haystack, i + nlen + 15, needle, nlen, 1);
+}
+
+/**
+ * ?internal
+ *
+ * InternalMemMemAVX2
+ *
+ * Same as InternalMemMemSSE2 but compares 32 positions at once.
+ */
+__attribute__((target("avx2")))
+char* ctr_internal_memmem_avx2(char* haystack, long hlen, char* needle, long nlen, int reverse ) {
+	__m256i first = _mm256_set1_epi8(needle[0]);
+	__m256i last = _mm256_set1_epi8(needle[nlen - 1]);
+	__m256i a, b;
+	unsigned int mask;
+	long i;
+	int bit;
+	if (!reverse) {
+		for(i = 0; i + nlen + 31 <= hlen; i += 32) {
+			a = _mm256_loadu_si256((__m256i*) (haystack + i));
+			b = _mm256_loadu_si256((__m256i*) (haystack + i + nlen - 1));
+			mask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+			while(mask) {
+				bit = __builtin_ctz(mask);
+				if (nlen < 3 || memcmp(haystack + i + bit + 1, needle + 1, nlen - 2) == 0) return haystack + i + bit;
+				mask &= mask - 1;
+			}
+		}
+		return ctr_internal_memmem_scalar(haystack + i, hlen - i, needle, nlen, 0);
+	}
+	for(i = hlen - nlen - 31; i >= 0; i -= 32) {
+		a = _mm256_loadu_si256((__m256i*) (haystack + i));
+		b = _mm256_loadu_si256((__m256i*) (haystack + i + nlen - 1));
+		mask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+		while(mask) {
+			bit = 31 - __builtin_clz(mask);
+			if (nlen < 3 || memcmp(haystack + i + bit + 1, needle + 1, nlen - 2) == 0) return haystack + i + bit;
+			mask &= ~(1u << bit);
+		}
+	}
+	return ctr_internal_memmem_scalar(haystack, i + nlen + 31, needle, nlen, 1);
+}
+
+#endif
+
+/**
+ * ?internal
+ *
+ * InternalMemMemSelect
+ *
+ * Selects the fastest substring search supported by the processor.
+ */
+char* (*ctr_internal_memmem_impl)(char* haystack, long hlen, char* needle, long nlen, int reverse ) = NULL;
+void ctr_internal_memmem_select() {
+	ctr_internal_memmem_impl = &ctr_internal_memmem_scalar;
+#ifdef CTR_MEMMEM_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		ctr_internal_memmem_impl = &ctr_internal_memmem_avx2;
+	} else if (__builtin_cpu_supports("sse2")) {
+		ctr_internal_memmem_impl = &ctr_internal_memmem_sse2;
+	}
+#endif
+}
+
+/**
+ * ?internal
+ *
+ * InternalMemMem
+ *
+ * memmem implementation because this not available on every system,
+ * returns the first (or if reverse = 1, the last) occurrence of the
+ * needle in the haystack or NULL.
+ */
+char* ctr_internal_memmem(char* haystack, long hlen, char* needle, long nlen, int reverse ) {
+	if (nlen == 0) return NULL;
+	if (hlen == 0) return NULL;
+	if (hlen < nlen) return NULL;
+	if (ctr_internal_memmem_impl == NULL) ctr_internal_memmem_select();
+	return ctr_internal_memmem_impl(haystack, hlen, needle, nlen, reverse);
+}
+
+/**
+ * ?internal
+ *
+ * InternalHashKeyInitialize
+ *
+ * Generates the random key for hashing property names, this has to
+ * happen before the parser interns the first symbol.
+ */
+int ctr_hash_key_initialized = 0;
+void ctr_internal_hash_key_initialize() {
+	int i;
+	if (ctr_hash_key_initialized) return;
+	srand((unsigned)time(NULL));
+	for(i=0; i<16; i++) {
+		CtrHashKey[i] = (int) (rand() % 256);
+	}
+	ctr_hash_key_initialized = 1;
+}
+
+/**
+ * ?internal
+ *
+ * SymbolIntern
+ *
+ * Returns the symbol for the specified name, creating it if it does
+ * not exist yet. A symbol is a string object with a precomputed hash,
+ * the parser interns all selectors and variable names so the walker
+ * does not need to build a string for every lookup.
+ * Symbols are not part of the object list of the garbage collector and
+ * are not tracked (string evaluation rewinds tracked memory),
+ * they live until ctr_symbol_free_all() is called at exit.
+ */
+ctr_symbol** ctr_symbol_table = NULL;
+ctr_size ctr_symbol_table_capacity = 0;
+ctr_size ctr_symbol_count = 0;
+ctr_object* ctr_symbol_intern(char* name, ctr_size vlen) {
+	ctr_symbol** old_table;
+	ctr_size old_capacity;
+	ctr_symbol* symbol;
+	ctr_size mask;
+	ctr_size i;
+	ctr_size j;
+	uint64_t hash;
+	ctr_internal_hash_key_initialize();
+	hash = siphash24(name, vlen, CtrHashKey);
+	if ((ctr_symbol_count + 1) * 2 > ctr_symbol_table_capacity) {
+		old_table = ctr_symbol_table;
+		old_capacity = ctr_symbol_table_capacity;
+		ctr_symbol_table_capacity = old_capacity ? old_capacity * 2 : 256;
+		ctr_symbol_table = ctr_heap_allocate(ctr_symbol_table_capacity * sizeof(ctr_symbol*));
+		mask = ctr_symbol_table_capacity - 1;
+		for(i = 0; i < old_capacity; i++) {
+			if (!old_table[i]) continue;
+			j = old_table[i]->hash & mask;
+			while(ctr_symbol_table[j]) j = (j + 1) & mask;
+			ctr_symbol_table[j] = old_table[i];
+		}
+		if (old_table) ctr_heap_free(old_table);
+	}
+	mask = ctr_symbol_table_capacity - 1;
+	i = hash & mask;
+	while((symbol = ctr_symbol_table[i])) {
+		if (symbol->hash == hash && symbol->string.vlen == vlen && memcmp(symbol->string.value, name, vlen) == 0) {
+			return (ctr_object*) symbol;
+		}
+		i = (i + 1) & mask;
+	}
+	symbol = ctr_heap_allocate(sizeof(ctr_symbol));
+	symbol->object.properties = ctr_heap_allocate(sizeof(ctr_map));
+	symbol->object.methods = ctr_heap_allocate(sizeof(ctr_map));
+	symbol->object.info.type = CTR_OBJECT_TYPE_OTSTRING;
+	symbol->object.info.sticky = 1;
+	symbol->object.info.symbol = 1;
+	symbol->object.info.old = 1;
+	symbol->object.link = CtrStdString;
+	symbol->object.value.svalue = &symbol->string;
+	symbol->string.value = "";
+	if (vlen) {
+		symbol->string.value = ctr_heap_allocate(vlen);
+		memcpy(symbol->string.value, name, vlen);
+	}
+	symbol->string.vlen = vlen;
+	symbol->hash = hash;
+	ctr_symbol_table[i] = symbol;
+	ctr_symbol_count++;
+	return (ctr_object*) symbol;
+}
+
+/**
+ * ?internal
+ *
+ * SymbolFreeAll
+ *
+ * Releases all symbols, only to be used when the program ends.
+ */
+void ctr_symbol_free_all() {
+	ctr_symbol* symbol;
+	ctr_mapitem* item;
+	ctr_mapitem* next;
+	ctr_map* maps[2];
+	ctr_size i;
+	int m;
+	for(i = 0; i < ctr_symbol_table_capacity; i++) {
+		symbol = ctr_symbol_table[i];
+		if (!symbol) continue;
+		maps[0] = symbol->object.properties;
+		maps[1] = symbol->object.methods;
+		for(m = 0; m < 2; m++) {
+			item = maps[m]->head;
+			while(item) {
+				next = item->next;
+				ctr_heap_free(item);
+				item = next;
+			}
+			if (maps[m]->index) ctr_heap_free(maps[m]->index);
+			ctr_heap_free(maps[m]);
+		}
+		if (symbol->string.vlen) ctr_heap_free(symbol->string.value);
+		ctr_heap_free(symbol);
+	}
+	if (ctr_symbol_table) ctr_heap_free(ctr_symbol_table);
+	ctr_symbol_table = NULL;
+	ctr_symbol_table_capacity = 0;
+	ctr_symbol_count = 0;
+}
+
 /**
  * ?internal
  *
@@ -364,12 +788,9 @@ char* ctr_internal_memmem(char* haystack, long hlen, char* needle, long nlen, in
 ctr_object* ctr_internal_create_object(int type) {
 	ctr_object* o;
 	o = ctr_heap_allocate(sizeof(ctr_object));
-	o->properties = ctr_heap_allocate(sizeof(ctr_map));
-	o->methods = ctr_heap_allocate(sizeof(ctr_map));
-	o->properties->size = 0;
-	o->methods->size = 0;
-	o->properties->head = NULL;
-	o->methods->head = NULL;
+	/* most objects never get properties or methods of their own, the maps are allocated by the first write */
+	o->properties = NULL;
+	o->methods = NULL;
 	o->info.type = type;
 	o->info.sticky = 0;
 	o->info.mark = 0;
@@ -384,16 +805,73 @@ ctr_object* ctr_internal_create_object(int type) {
 	if (type==CTR_OBJECT_TYPE_OTBLOCK) {
 		o->value.block = NULL;
 	}
-	o->gnext = NULL;
-	if (ctr_first_object == NULL) {
-		ctr_first_object = o;
-	} else {
-		o->gnext = ctr_first_object;
-		ctr_first_object = o;
+	/* new objects are born in the young generation */
+	o->gnext = ctr_first_young;
+	ctr_first_young = o;
+	ctr_gc_young_counter++;
+	return o;
+}
+
+/**
+ * ?internal
+ *
+ * InternalConstantCreate
+ *
+ * Creates the immutable object of a string or number literal.
+ * Constants are allocated in the arena along with the AST they belong
+ * to, they never enter the object list and are never swept.
+ */
+ctr_object* ctr_internal_create_constant(int type) {
+	ctr_object* o;
+	o = ctr_heap_allocate_arena(sizeof(ctr_object));
+	o->properties = ctr_heap_allocate_arena(sizeof(ctr_map));
+	o->methods = ctr_heap_allocate_arena(sizeof(ctr_map));
+	o->info.type = type;
+	o->info.constant = 1;
+	o->info.old = 1;
+	if (type==CTR_OBJECT_TYPE_OTSTRING) {
+		o->value.svalue = ctr_heap_allocate_arena(sizeof(ctr_string));
+		o->value.svalue->value = "";
+		o->value.svalue->vlen = 0;
+	}
+	return o;
+}
+
+/**
+ * ?internal
+ *
+ * InternalConstant
+ *
+ * Returns the constant of a literal node. Literals of the main
+ * program are parsed before the world exists, so the constant is
+ * linked to its prototype on first use.
+ */
+ctr_object* ctr_internal_constant(ctr_tnode* node) {
+	ctr_object* o = node->constant;
+	if (!o->link) {
+		o->link = (o->info.type == CTR_OBJECT_TYPE_OTNUMBER) ? CtrStdNumber : CtrStdString;
 	}
 	return o;
 }
 
+/**
+ * ?internal
+ *
+ * InternalConstantClone
+ *
+ * Copy-on-write: returns a private copy of a literal constant,
+ * any other object is returned as is. Constants are cloned whenever
+ * they are stored (variables, properties, collections) or receive
+ * a message that changes the receiver.
+ */
+ctr_object* ctr_internal_constant_clone(ctr_object* o) {
+	if (!o->info.constant) return o;
+	if (o->info.type == CTR_OBJECT_TYPE_OTNUMBER) {
+		return ctr_build_number_from_float(o->value.nvalue);
+	}
+	return ctr_build_string(o->value.svalue->value, o->value.svalue->vlen);
+}
+
 /**
  * ?internal
  *
@@ -489,21 +967,77 @@ ctr_object* ctr_internal_cast2bool( ctr_object* o ) {
 	return boolObject;
 }
 
+/**
+ * ?internal
+ *
+ * ScopeFind
+ *
+ * Returns the slot of a variable in a scope or -1.
+ */
+int ctr_scope_find(ctr_scope* scope, ctr_object* key) {
+	ctr_size i;
+	ctr_object* name;
+	for(i = 0; i < scope->count; i++) {
+		name = scope->names[i];
+		if (name == key) return (int) i;
+		if (!key->info.symbol
+		&& key->value.svalue->vlen == name->value.svalue->vlen
+		&& memcmp(key->value.svalue->value, name->value.svalue->value, name->value.svalue->vlen) == 0) {
+			return (int) i;
+		}
+	}
+	return -1;
+}
+
 /**
  * ?internal
  *
  * ContextOpen
  *
- * Opens a new context to keep track of variables.
+ * Opens a new context to keep track of variables. The variables of
+ * the scope get a frame of slots, others are stored as properties of
+ * a context object that is only created once it is needed.
  */
-void ctr_open_context() {
-	ctr_object* context;
+void ctr_open_context(ctr_scope* scope) {
+	ctr_size count = scope ? scope->count : 0;
 	if (ctr_context_id >= 299) {
 		CtrStdFlow = ctr_error( CTR_ERR_NESTING, 0 );
 	}
-	context = ctr_internal_create_object(CTR_OBJECT_TYPE_OTOBJECT);
-	context->info.sticky = 1;
-	ctr_contexts[++ctr_context_id] = context;
+	if (ctr_slots_count + count > ctr_slots_capacity) {
+		if (ctr_slots_capacity) {
+			while(ctr_slots_count + count > ctr_slots_capacity) ctr_slots_capacity *= 2;
+			ctr_slots = ctr_heap_reallocate(ctr_slots, ctr_slots_capacity * sizeof(ctr_object*));
+		} else {
+			ctr_slots_capacity = 256;
+			while(count > ctr_slots_capacity) ctr_slots_capacity *= 2;
+			ctr_slots = ctr_heap_allocate(ctr_slots_capacity * sizeof(ctr_object*));
+		}
+	}
+	ctr_context_id++;
+	ctr_contexts[ctr_context_id] = NULL;
+	ctr_context_scope[ctr_context_id] = scope;
+	ctr_context_frame[ctr_context_id] = ctr_slots_count;
+	memset(ctr_slots + ctr_slots_count, 0, count * sizeof(ctr_object*));
+	ctr_slots_count += count;
+	ctr_context_roots[ctr_context_id] = ctr_gc_internal_roots();
+}
+
+/**
+ * ?internal
+ *
+ * ContextObject
+ *
+ * Returns the object that stores the variables of the current
+ * context that have no slot, creates it if necessary.
+ */
+ctr_object* ctr_context_object() {
+	ctr_object* context = ctr_contexts[ctr_context_id];
+	if (context == NULL) {
+		context = ctr_internal_create_object(CTR_OBJECT_TYPE_OTOBJECT);
+		context->info.sticky = 1;
+		ctr_contexts[ctr_context_id] = context;
+	}
+	return context;
 }
 
 /**
@@ -514,11 +1048,33 @@ void ctr_open_context() {
  * Closes a context.
  */
 void ctr_close_context() {
-	ctr_contexts[ctr_context_id]->info.sticky = 0;
+	if (ctr_contexts[ctr_context_id]) ctr_contexts[ctr_context_id]->info.sticky = 0;
 	if (ctr_context_id == 0) return;
+	/* release the pins made within this context */
+	ctr_gc_internal_unpin(ctr_context_roots[ctr_context_id]);
+	ctr_slots_count = ctr_context_frame[ctr_context_id];
 	ctr_context_id--;
 }
 
+/**
+ * ?internal
+ *
+ * ContextFind
+ *
+ * Looks up a variable in one context, first in the slots of its
+ * scope, then in its context object. Returns NULL if the variable
+ * has not been set in this context.
+ */
+ctr_object* ctr_context_find(int i, ctr_object* key) {
+	int slot;
+	if (ctr_context_scope[i]) {
+		slot = ctr_scope_find(ctr_context_scope[i], key);
+		if (slot >= 0) return ctr_slots[ctr_context_frame[i] + slot];
+	}
+	if (ctr_contexts[i] == NULL) return NULL;
+	return ctr_internal_object_find_property(ctr_contexts[i], key, 0);
+}
+
 /**
  * ?internal
  *
@@ -532,8 +1088,7 @@ ctr_object* ctr_find(ctr_object* key) {
 	ctr_object* foundObject = NULL;
 	if (CtrStdFlow) return CtrStdNil;
 	while((i>-1 && foundObject == NULL)) {
-		ctr_object* context = ctr_contexts[i];
-		foundObject = ctr_internal_object_find_property(context, key, 0);
+		foundObject = ctr_context_find(i, key);
 		i--;
 	}
 	if (foundObject == NULL) {
@@ -560,6 +1115,24 @@ ctr_object* ctr_find(ctr_object* key) {
 	return foundObject;
 }
 
+/**
+ * ?internal
+ *
+ * CTRFindVariable
+ *
+ * Looks up the variable of a reference node, takes the slot
+ * directly if the reference belongs to the scope of the current
+ * context and the variable has been set.
+ */
+ctr_object* ctr_find_variable(ctr_tnode* ref) {
+	ctr_object* foundObject;
+	if (ref->slot && !CtrStdFlow && ref->scope == ctr_context_scope[ctr_context_id]) {
+		foundObject = ctr_slots[ctr_context_frame[ctr_context_id] + ref->slot - 1];
+		if (foundObject) return foundObject;
+	}
+	return ctr_find(ref->symbol);
+}
+
 /**
  * ?internal
  *
@@ -568,7 +1141,7 @@ ctr_object* ctr_find(ctr_object* key) {
  * Tries to locate a property of an object.
  */
 ctr_object* ctr_find_in_my(ctr_object* key) {
-	ctr_object* context = ctr_find(ctr_build_string_from_cstring( ctr_clex_keyword_me_icon ) );
+	ctr_object* context = ctr_find( CtrSymbolMe );
 	ctr_object* foundObject = ctr_internal_object_find_property(context, key, 0);
 	if (CtrStdFlow) return CtrStdNil;
 	if (foundObject == NULL) {
@@ -600,11 +1173,19 @@ ctr_object* ctr_find_in_my(ctr_object* key) {
  */
 void ctr_set(ctr_object* key, ctr_object* object) {
 	int i = ctr_context_id;
+	int slot;
 	ctr_object* context;
 	ctr_object* foundObject = NULL;
 	while((i>-1 && foundObject == NULL)) {
+		if (ctr_context_scope[i]) {
+			slot = ctr_scope_find(ctr_context_scope[i], key);
+			if (slot >= 0 && ctr_slots[ctr_context_frame[i] + slot]) {
+				ctr_slots[ctr_context_frame[i] + slot] = object;
+				return;
+			}
+		}
 		context = ctr_contexts[i];
-		foundObject = ctr_internal_object_find_property(context, key, 0);
+		if (context) foundObject = ctr_internal_object_find_property(context, key, 0);
 		if (foundObject) break;
 		i--;
 	}
@@ -628,6 +1209,20 @@ void ctr_set(ctr_object* key, ctr_object* object) {
 	ctr_internal_object_set_property(context, key, object, 0);
 }
 
+/**
+ * ?internal
+ *
+ * SymbolsInitialize
+ *
+ * Interns the symbols of the variables every block has,
+ * the parser needs them before the World exists.
+ */
+void ctr_internal_symbols_initialize() {
+	CtrSymbolMe = ctr_symbol_intern( ctr_clex_keyword_me_icon, strlen( ctr_clex_keyword_me_icon ) );
+	CtrSymbolMy = ctr_symbol_intern( ctr_clex_keyword_my_icon, strlen( ctr_clex_keyword_my_icon ) );
+	CtrSymbolCurrentTask = ctr_symbol_intern( CTR_DICT_CURRENT_TASK, strlen( CTR_DICT_CURRENT_TASK ) );
+}
+
 /**
  * ?internal
  *
@@ -638,12 +1233,11 @@ void ctr_set(ctr_object* key, ctr_object* object) {
 ctr_object* currentMethod;
 void ctr_initialize_world() {
 	ctr_internal_recursion = 0;
-	int i;
+	ctr_size i;
+	ctr_internal_hash_key_initialize();
 	srand((unsigned)time(NULL));
-	for(i=0; i<16; i++) {
-		CtrHashKey[i] = (int) (rand() % 256);
-	}
 	ctr_first_object = NULL;
+	ctr_first_young = NULL;
 	CtrStdWorld = ctr_internal_create_object(CTR_OBJECT_TYPE_OTOBJECT);
 	CtrStdWorld->info.sticky = 1;
 	ctr_contexts[0] = CtrStdWorld;
@@ -792,6 +1386,11 @@ void ctr_initialize_world() {
 
 	/* String */
 	CtrStdString = ctr_internal_create_object(CTR_OBJECT_TYPE_OTSTRING);
+	/* symbols interned by the parser before the world existed */
+	for(i = 0; i < ctr_symbol_table_capacity; i++) {
+		if (ctr_symbol_table[i]) ctr_symbol_table[i]->object.link = CtrStdString;
+	}
+	ctr_internal_symbols_initialize();
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_NEW ), &ctr_string_new );
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_LENGTH ), &ctr_string_length );
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_FROM_LENGTH ), &ctr_string_from_length );
@@ -829,11 +1428,25 @@ void ctr_initialize_world() {
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_CODE ), &ctr_string_to_code );
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_TOOBJECT ), &ctr_string_eval );
 	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_MINUS ), &ctr_string_minus );
-	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( "bytes" ), &ctr_string_bytes );
+	ctr_internal_create_func(CtrStdString, ctr_build_string_from_cstring( CTR_DICT_BYTES ), &ctr_string_bytes );
 	ctr_internal_object_add_property(CtrStdWorld, ctr_build_string_from_cstring( CTR_DICT_STRING ), CtrStdString, 0 );
 	CtrStdString->link = CtrStdObject;
 	CtrStdString->info.sticky = 1;
 
+	/* Buffer */
+	CtrStdBuffer = ctr_internal_create_object(CTR_OBJECT_TYPE_OTSTRING);
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_NEW ), &ctr_buffer_new );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_TYPE ), &ctr_buffer_type );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_APPEND ), &ctr_buffer_append );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_ADD_SET ), &ctr_buffer_append );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_LENGTH ), &ctr_string_length );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_BYTES ), &ctr_string_bytes );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_TOSTRING ), &ctr_buffer_to_string );
+	ctr_internal_create_func(CtrStdBuffer, ctr_build_string_from_cstring( CTR_DICT_FLUSH ), &ctr_buffer_flush );
+	ctr_internal_object_add_property(CtrStdWorld, ctr_build_string_from_cstring( CTR_DICT_BUFFER ), CtrStdBuffer, 0 );
+	CtrStdBuffer->link = CtrStdObject;
+	CtrStdBuffer->info.sticky = 1;
+
 	/* Block */
 	CtrStdBlock = ctr_internal_create_object(CTR_OBJECT_TYPE_OTBLOCK);
 	ctr_internal_create_func(CtrStdBlock, ctr_build_string_from_cstring( CTR_DICT_RUN ), &ctr_block_runIt );
@@ -871,6 +1484,8 @@ void ctr_initialize_world() {
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_AT ), &ctr_array_get );
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_AT_SYMBOL ), &ctr_array_get );
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_SORT ), &ctr_array_sort );
+	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_SORT_NATURAL ), &ctr_array_sort_natural );
+	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_SORT_BY ), &ctr_array_sort_by );
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_PUT_AT ), &ctr_array_put );
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_FROM_LENGTH ), &ctr_array_from_length );
 	ctr_internal_create_func(CtrStdArray, ctr_build_string_from_cstring( CTR_DICT_SPLICE ), &ctr_array_splice );
@@ -900,6 +1515,7 @@ void ctr_initialize_world() {
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_AT ), &ctr_map_get );
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_AT_SYMBOL ), &ctr_map_get );
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_COUNT ), &ctr_map_count );
+	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_COPY ), &ctr_map_copy );
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_EACH ), &ctr_map_each );
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_MAP ), &ctr_map_each );
 	ctr_internal_create_func(CtrStdMap, ctr_build_string_from_cstring( CTR_DICT_TOSTRING ), &ctr_map_to_string );
@@ -1039,6 +1655,43 @@ void ctr_initialize_world() {
 	ctr_internal_object_set_property( ctr_contexts[ctr_context_id], ctr_build_string_from_cstring(".rs"), ctr_build_number_from_float(1), CTR_CATEGORY_PRIVATE_PROPERTY );
 }
 
+/**
+ * ?internal
+ *
+ * MethodInUse
+ *
+ * Determines whether the method is currently running, in that case
+ * the message is meant for the parent unless the recursive flag
+ * has been set for this receiver.
+ */
+int ctr_internal_method_in_use(ctr_object* methodObject, ctr_object* receiverObject) {
+	int j;
+	for(j = ctr_message_stack_index; j >= 0; j--) {
+		if (ctr_message_stack[j]==methodObject) {
+			if (ctr_internal_recursion != receiverObject) {
+				return 1;
+			}
+			ctr_internal_recursion = NULL;
+			return 0;
+		}
+	}
+	return 0;
+}
+
+/**
+ * ?internal
+ *
+ * InlineCacheKey
+ *
+ * Returns the object where the method lookup for the receiver
+ * effectively begins: the receiver itself if it has methods of its own,
+ * its prototype otherwise.
+ */
+ctr_object* ctr_internal_inline_cache_key(ctr_object* receiverObject) {
+	if (receiverObject->methods && receiverObject->methods->size > 0) return receiverObject;
+	return receiverObject->link;
+}
+
 /**
  * ?internal
  *
@@ -1048,51 +1701,125 @@ void ctr_initialize_world() {
  */
 ctr_object* ctr_internal_tmp_msg = NULL;
 ctr_object* ctr_send_message(ctr_object* receiverObject, char* message, long vlen, ctr_argument* argumentList) {
+	if (CtrStdFlow != NULL) return CtrStdNil; /* Error mode, ignore subsequent messages until resolved. */
+	if (!ctr_internal_tmp_msg) {
+		ctr_internal_tmp_msg = ctr_build_empty_string();
+		ctr_internal_tmp_msg->info.sticky = 1;
+	}
+	if (ctr_internal_tmp_msg->value.svalue->vlen) {
+		ctr_heap_free(ctr_internal_tmp_msg->value.svalue->value);
+	}
+	ctr_internal_tmp_msg->value.svalue->value = ctr_heap_allocate(vlen);
+	memcpy(ctr_internal_tmp_msg->value.svalue->value, message, vlen);
+	ctr_internal_tmp_msg->value.svalue->vlen = vlen;
+	ctr_internal_tmp_msg->value.svalue->capacity = vlen;
+	ctr_utf8_forget(ctr_internal_tmp_msg->value.svalue);
+	return ctr_send_message_symbol(receiverObject, ctr_internal_tmp_msg, argumentList, NULL);
+}
+
+/**
+ * ?internal
+ *
+ * InternalConstantMutator
+ *
+ * Determines whether a method may change its receiver, in which case
+ * a literal constant receives the message through a private copy.
+ * Blocks bound to the receiver might assign properties to me.
+ */
+int ctr_internal_constant_mutator(ctr_object* methodObject) {
+	ctr_object* (*funct)(ctr_object* receiverObject, ctr_argument* argumentList);
+	if (methodObject->info.type == CTR_OBJECT_TYPE_OTBLOCK) {
+		return (methodObject->info.selfbind == 1);
+	}
+	if (methodObject->info.type != CTR_OBJECT_TYPE_OTNATFUNC) return 0;
+	funct = methodObject->value.fvalue;
+	return (funct == ctr_number_inc
+		|| funct == ctr_number_dec
+		|| funct == ctr_number_mul
+		|| funct == ctr_number_div
+		|| funct == ctr_number_qualify
+		|| funct == ctr_string_append
+		|| funct == ctr_string_from_length
+		|| funct == ctr_string_skip
+		|| funct == ctr_string_to_upper
+		|| funct == ctr_string_to_lower
+		|| funct == ctr_string_replace_with
+		|| funct == ctr_string_fill_in
+		|| funct == ctr_string_trim
+		|| funct == ctr_object_do
+		|| funct == ctr_object_done
+		|| funct == ctr_object_on_do
+		|| funct == ctr_object_learn_meaning
+	);
+}
+
+/**
+ * ?internal
+ *
+ * CTRMessageSendSymbol
+ *
+ * Sends a message to a receiver object, the selector is a string
+ * object, usually a symbol interned by the parser so its hash is
+ * already known. The inline cache of the call site (if any) is
+ * consulted before walking the prototype chain.
+ */
+ctr_object* ctr_send_message_symbol(ctr_object* receiverObject, ctr_object* selector, ctr_argument* argumentList, ctr_inline_cache* cache) {
 	ctr_object* methodObject;
 	ctr_object* searchObject;
 	ctr_object* returnValue;
+	ctr_object* cacheKey = NULL;
+	ctr_object* copy = NULL;
 	ctr_argument* argCounter;
 	ctr_argument* mesgArgument;
 	ctr_object* result = CtrStdNil;
 	ctr_object* (*funct)(ctr_object* receiverObject, ctr_argument* argumentList);
+	char* message = selector->value.svalue->value;
+	long vlen = selector->value.svalue->vlen;
+	int cacheable;
+	int i;
+	if (ctr_profile_tick) ctr_profile_sample();
 	if (receiverObject == NULL) {
 		ctr_print_error("[Error] ctr_send_message: Receiver cannot be NULL.", 1);
 	}
-	if (!ctr_internal_tmp_msg) {
-		ctr_internal_tmp_msg = ctr_build_empty_string();
-		ctr_internal_tmp_msg->info.sticky = 1;
-	}
 	int argCount;
-	int j;
 	if (CtrStdFlow != NULL) return CtrStdNil; /* Error mode, ignore subsequent messages until resolved. */
 	methodObject = NULL;
-	searchObject = receiverObject;
-	//Is the message the same as the current message? Then, it is meant for the parent
-	//unless the recursive flag has been set.
-	if (ctr_internal_tmp_msg->value.svalue->vlen) {
-		ctr_heap_free(ctr_internal_tmp_msg->value.svalue->value);
-	}
-	ctr_internal_tmp_msg->value.svalue->value = ctr_heap_allocate(vlen);
-	memcpy(ctr_internal_tmp_msg->value.svalue->value, message, vlen);
-	ctr_internal_tmp_msg->value.svalue->vlen = vlen;
-	while(!methodObject) {
-		methodObject = ctr_internal_object_find_property(searchObject, ctr_internal_tmp_msg, 1);
-		if (methodObject) {
-			for(j = ctr_message_stack_index; j >= 0; j--) {
-				if (ctr_message_stack[j]==methodObject) {
-					if (ctr_internal_recursion != receiverObject) {
-						methodObject = NULL;
-						break;
-					} else {
-						ctr_internal_recursion = NULL;
-						break;
-					}
+	if (cache) {
+		if (cache->epoch != ctr_method_epoch) {
+			memset(cache, 0, sizeof(ctr_inline_cache));
+			cache->epoch = ctr_method_epoch;
+		}
+		cacheKey = ctr_internal_inline_cache_key(receiverObject);
+		for(i = 0; cacheKey && i < CTR_INLINE_CACHE_SIZE; i++) {
+			if (cache->entries[i].key == cacheKey) {
+				methodObject = cache->entries[i].method;
+				if (ctr_internal_method_in_use(methodObject, receiverObject)) {
+					methodObject = NULL;
 				}
+				break;
 			}
 		}
-		if (methodObject) break;
-		if (!searchObject->link) break;
-		searchObject = searchObject->link;
+	}
+	if (!methodObject) {
+		/* only cache the outcome of a lookup that did not depend on the message stack */
+		cacheable = (cacheKey != NULL);
+		searchObject = receiverObject;
+		while(!methodObject) {
+			methodObject = ctr_internal_object_find_property(searchObject, selector, 1);
+			if (methodObject && ctr_internal_method_in_use(methodObject, receiverObject)) {
+				methodObject = NULL;
+				cacheable = 0;
+			}
+			if (methodObject) break;
+			if (!searchObject->link) break;
+			searchObject = searchObject->link;
+		}
+		if (methodObject && cacheable) {
+			cacheKey->info.keyed = 1;
+			cache->entries[cache->next].key = cacheKey;
+			cache->entries[cache->next].method = methodObject;
+			cache->next = (cache->next + 1) % CTR_INLINE_CACHE_SIZE;
+		}
 	}
 	if (!methodObject) {
 		argCounter = argumentList;
@@ -1118,6 +1845,12 @@ ctr_object* ctr_send_message(ctr_object* receiverObject, char* message, long vle
 		if (receiverObject->info.chainMode == 1) return receiverObject;
 		return returnValue;
 	}
+	if (receiverObject->info.constant && ctr_internal_constant_mutator(methodObject)) {
+		receiverObject = ctr_internal_constant_clone(receiverObject);
+		/* the copy takes over the protection the caller gave to the constant */
+		copy = receiverObject;
+		copy->info.sticky = 1;
+	}
 	if (methodObject->info.type == CTR_OBJECT_TYPE_OTNATFUNC) {
 		funct = methodObject->value.fvalue;
 		if (ctr_deserialize_mode
@@ -1144,6 +1877,7 @@ ctr_object* ctr_send_message(ctr_object* receiverObject, char* message, long vle
 	if (methodObject->info.type == CTR_OBJECT_TYPE_OTBLOCK && methodObject->info.selfbind == 0) {
 		result = ctr_block_run(methodObject, argumentList, NULL);
 	}
+	if (copy) copy->info.sticky = 0;
 	if (receiverObject->info.chainMode == 1) return receiverObject;
 	return result;
 }
@@ -1160,7 +1894,7 @@ ctr_object* ctr_assign_value(ctr_object* key, ctr_object* o) {
 	ctr_object* object = NULL;
 	if (CtrStdFlow) return CtrStdNil;
 	key->info.sticky = 0;
-	object = o;
+	object = ctr_internal_constant_clone(o);
 	ctr_set(key, object);
 	return object;
 }
@@ -1175,10 +1909,10 @@ ctr_object* ctr_assign_value(ctr_object* key, ctr_object* o) {
  */
 ctr_object* ctr_assign_value_to_my(ctr_object* key, ctr_object* o) {
 	ctr_object* object = NULL;
-	ctr_object* my = ctr_find(ctr_build_string_from_cstring( ctr_clex_keyword_me_icon ) );
+	ctr_object* my = ctr_find( CtrSymbolMe );
 	if (CtrStdFlow) return CtrStdNil;
 	key->info.sticky = 0;
-	object = o;
+	object = ctr_internal_constant_clone(o);
 	ctr_internal_object_set_property(my, key, object, 0);
 	return object;
 }
@@ -1192,12 +1926,72 @@ ctr_object* ctr_assign_value_to_my(ctr_object* key, ctr_object* o) {
  */
 ctr_object* ctr_assign_value_to_local(ctr_object* key, ctr_object* o) {
 	ctr_object* object = NULL;
-	ctr_object* context;
+	int slot;
 	if (CtrStdFlow) return CtrStdNil;
-	context = ctr_contexts[ctr_context_id];
 	key->info.sticky = 0;
-	object = o;
-	ctr_internal_object_set_property(context, key, object, 0);
+	object = ctr_internal_constant_clone(o);
+	if (ctr_context_scope[ctr_context_id]) {
+		slot = ctr_scope_find(ctr_context_scope[ctr_context_id], key);
+		if (slot >= 0) {
+			ctr_slots[ctr_context_frame[ctr_context_id] + slot] = object;
+			return object;
+		}
+	}
+	ctr_internal_object_set_property(ctr_context_object(), key, object, 0);
+	return object;
+}
+
+/**
+ * ?internal
+ *
+ * CTRAssignValueSlot
+ *
+ * Assigns a value to a slot (plus one) of the current context,
+ * the key is used instead if the slot is 0 or the context has
+ * no scope.
+ */
+ctr_object* ctr_assign_value_to_slot(int slot, ctr_object* key, ctr_object* o) {
+	ctr_object* object;
+	if (!slot || !ctr_context_scope[ctr_context_id]) return ctr_assign_value_to_local(key, o);
+	if (CtrStdFlow) return CtrStdNil;
+	object = ctr_internal_constant_clone(o);
+	ctr_slots[ctr_context_frame[ctr_context_id] + slot - 1] = object;
 	return object;
 }
 
+/**
+ * ?internal
+ *
+ * CTRAssignVariable
+ *
+ * Assigns a value to the variable of a reference node, writes
+ * the slot directly if the reference belongs to the scope of the
+ * current context and the variable has been set.
+ */
+ctr_object* ctr_assign_variable(ctr_tnode* ref, ctr_object* o) {
+	ctr_object** slot;
+	if (ref->slot && !CtrStdFlow && ref->scope == ctr_context_scope[ctr_context_id]) {
+		slot = ctr_slots + ctr_context_frame[ctr_context_id] + ref->slot - 1;
+		if (*slot) {
+			*slot = ctr_internal_constant_clone(o);
+			return *slot;
+		}
+	}
+	return ctr_assign_value(ref->symbol, o);
+}
+
+/**
+ * ?internal
+ *
+ * CTRAssignLocalVariable
+ *
+ * Declares the variable of a reference node in the current context,
+ * writes the slot directly if the reference belongs to its scope.
+ */
+ctr_object* ctr_assign_local_variable(ctr_tnode* ref, ctr_object* o) {
+	if (ref->slot && ref->scope == ctr_context_scope[ctr_context_id]) {
+		return ctr_assign_value_to_slot(ref->slot, ref->symbol, o);
+	}
+	return ctr_assign_value_to_local(ref->symbol, o);
+}
+